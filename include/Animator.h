@@ -7,6 +7,13 @@
 // Lightweight animator supporting either per-frame textures or a single spritesheet + rects.
 class Animator {
 public:
+    // Visual level of detail. The logical frame index, onFrame and onComplete always advance at
+    // full rate so gameplay code reading getCurrentFrameIndex() keeps exact timing.
+    //  Full    - every frame is applied to the sprite
+    //  Half    - only every second advanced frame is applied (distant, on-screen)
+    //  Logical - no setTexture/setTextureRect calls at all (off-screen); caught up on return
+    enum class LOD { Full, Half, Logical };
+
     Animator()
         : sprite(nullptr), texFrames(nullptr), sheetTexture(nullptr), frameTime(0.1f), timer(0.f), currentFrame(0), playing(false), loop(true) {}
 
@@ -64,6 +71,14 @@ public:
     // Allow runtime adjustment of frame time without resetting animation state
     void setFrameTime(float ft) { frameTime = ft; }
 
+    void setLOD(LOD l) {
+        if (lod == l) return;
+        lod = l;
+        // Returning to a visible tier: make the sprite show the current logical frame
+        if (lod != LOD::Logical && framePending && sprite && hasFrames()) applyFrame(currentFrame);
+    }
+    LOD getLOD() const { return lod; }
+
     // Set current frame index and apply it (resets timer)
     void setCurrentFrame(size_t idx) { if (!sprite) return; if (texFrames) currentFrame = (idx < texFrames->size()) ? idx : 0; else if (sheetTexture) currentFrame = (idx < rects.size()) ? idx : 0; timer = 0.f; applyFrame(currentFrame); }
 
@@ -79,6 +94,9 @@ private:
     bool loop;
     std::function<void()> onComplete;
     std::function<void(size_t)> onFrame;
+    LOD lod = LOD::Full;
+    bool framePending = false; // sprite is showing a stale frame because of LOD skipping
+    unsigned halfRateCounter = 0;
 
     bool hasFrames() const {
         return (texFrames && !texFrames->empty()) || (sheetTexture && !rects.empty());
@@ -86,6 +104,12 @@ private:
 
     void applyFrame(size_t idx) {
         if (!sprite) return;
+        if (lod == LOD::Logical) {
+            framePending = true;
+            if (onFrame) onFrame(idx);
+            return;
+        }
+        framePending = false;
         if (texFrames && idx < texFrames->size()) {
             sprite->setTexture((*texFrames)[idx]);
         } else if (sheetTexture && idx < rects.size()) {
@@ -95,6 +119,16 @@ private:
         if (onFrame) onFrame(idx);
     }
 
+    // Apply an advanced frame honoring the half-rate tier (state switches always apply immediately)
+    void presentFrame(size_t idx) {
+        if (lod == LOD::Half && (++halfRateCounter & 1u) != 0) {
+            framePending = true;
+            if (onFrame) onFrame(idx);
+            return;
+        }
+        applyFrame(idx);
+    }
+
     void advanceFrame() {
         if (texFrames) {
             ++currentFrame;
@@ -102,14 +136,14 @@ private:
                 if (loop) currentFrame = 0;
                 else { currentFrame = texFrames->empty() ? 0 : texFrames->size() - 1; playing = false; if (onComplete) onComplete(); }
             }
-            applyFrame(currentFrame);
+            presentFrame(currentFrame);
         } else if (sheetTexture) {
             ++currentFrame;
             if (currentFrame >= rects.size()) {
                 if (loop) currentFrame = 0;
                 else { currentFrame = rects.empty() ? 0 : rects.size() - 1; playing = false; if (onComplete) onComplete(); }
             }
-            applyFrame(currentFrame);
+            presentFrame(currentFrame);
         }
     }
 };
@@ -0,0 +1,32 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cmath>
+
+class BaseZombie;
+
+// Oriented attack volume captured once per step for an attacking zombie. The local axes are stored as
+// unit vectors so overlap tests need no trig.
+struct AttackOBB {
+    sf::Vector2f center;
+    sf::Vector2f halfExtents;
+    sf::Vector2f axis;           // forward (local x); local y is its perpendicular
+    float boundingRadius = 0.f;  // length of halfExtents, for distance early-outs
+    BaseZombie* owner = nullptr;
+};
+
+// SAT test of an attack OBB against an axis-aligned rect
+inline bool intersects(const AttackOBB& o, const sf::FloatRect& aabb) {
+    const sf::Vector2f& ux = o.axis;
+    const sf::Vector2f uy(-ux.y, ux.x);
+    const sf::Vector2f& he = o.halfExtents;
+    const float aw = aabb.width * 0.5f, ah = aabb.height * 0.5f;
+    const sf::Vector2f t(aabb.left + aw - o.center.x, aabb.top + ah - o.center.y);
+
+    // OBB axes
+    if (std::abs(t.x * ux.x + t.y * ux.y) > he.x + std::abs(aw * ux.x) + std::abs(ah * ux.y)) return false;
+    if (std::abs(t.x * uy.x + t.y * uy.y) > he.y + std::abs(aw * uy.x) + std::abs(ah * uy.y)) return false;
+    // world axes
+    if (std::abs(t.x) > std::abs(ux.x * he.x) + std::abs(uy.x * he.y) + aw) return false;
+    if (std::abs(t.y) > std::abs(ux.y * he.x) + std::abs(uy.y * he.y) + ah) return false;
+    return true;
+}
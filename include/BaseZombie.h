@@ -6,6 +6,10 @@
 #include <vector>
 #include <string>
 #include "Animator.h"
+#include "TransformBuffer.h"
+
+class RenderQueue;
+class ShadowBarRenderer;
 
 enum class ZombieState {
     WALK,
@@ -21,22 +25,31 @@ enum class ZombieType {
     KING
 };
 
+// Per-type behaviour tables and the batch update live in ZombieBehavior.h
+template<ZombieType T> struct ZombieBehavior;
+
 class BaseZombie : public Entity {
 public:
     BaseZombie(float x, float y, float health, float attackDamage, float speed, float attackRange, float attackCooldown);
     virtual ~BaseZombie() = default;
 
-    virtual void update(float deltaTime, sf::Vector2f playerPosition);
-    virtual void draw(sf::RenderWindow& window) const;
+    // Submit body and attack flash to the world render queue (see LevelManager::drawZombies)
+    virtual void draw(RenderQueue& queue) const;
+    // Queue the blob shadow (drawn under all bodies) and the health bar (drawn over them)
+    void drawShadowAndHealthBar(ShadowBarRenderer& overlays) const;
 
+    // Sprite bounds at the interpolated render position (used for view culling)
     sf::FloatRect getBounds() const;
     sf::FloatRect getHitbox() const;
     // Return the attack hitbox (area the zombie can damage when attacking). Default implementation provided in .cpp
     virtual sf::FloatRect getAttackHitbox() const;
     // Provide oriented attack box: center (world), half extents (half width, half height), rotation degrees
     virtual void getAttackOBB(sf::Vector2f& outCenter, sf::Vector2f& outHalfExtents, float& outRotationDeg) const;
+    // Same box with the forward axis as a unit vector instead of an angle (no trig; used by the batched attack test)
+    void getAttackBox(sf::Vector2f& outCenter, sf::Vector2f& outHalfExtents, sf::Vector2f& outForward) const;
 
-    virtual void attack();
+    // Enter the attack state and start the attack clip (driven by the behaviour table)
+    void attack();
     virtual void takeDamage(float amount);
     // Called when hit by a bullet so the zombie can spawn effects (blood, guts, explosions)
     virtual void onHitByBullet(const Vec2& hitPos, const Vec2& bulletVelocity, int remainingPenetrations);
@@ -54,7 +67,10 @@ public:
     float getAttackDamage() const;
 
     sf::Vector2f getPosition() const; // Returns SFML vector for compatibility
-    virtual float tryDealDamage();
+    // Current animation frame/orientation (position is only applied at draw time); used to snapshot corpses
+    const sf::Sprite& getSprite() const { return sprite; }
+    // Returns attackDamage once per attack while the current frame is inside the type's damage window
+    float tryDealDamage();
     bool hasDealtDamageInAttack() const;
 
     virtual ZombieType getType() const = 0;
@@ -63,25 +79,35 @@ public:
     void setWalkFrameTime(float t) { walkFrameTime = t; if (currentState == ZombieState::WALK) animator.setFrameTime(walkFrameTime); }
     float getWalkFrameTime() const { return walkFrameTime; }
 
-    // Interpolation positions for smooth rendering
-    sf::Vector2f prevPos = sf::Vector2f(0.f, 0.f);
-    sf::Vector2f currPos = sf::Vector2f(0.f, 0.f);
-    float renderAlpha = 1.0f;
-    void setRenderAlpha(float a) { renderAlpha = a; }
+    // Animation level of detail chosen by LevelManager from camera visibility/distance.
+    // Attacking zombies are always animated at full rate so damage/lunge frames stay readable.
+    void setAnimationLOD(Animator::LOD lod) { animLOD = lod; }
+    Animator::LOD getAnimationLOD() const { return animLOD; }
+
+    // Perception, set by LevelManager each step. Zombies that can't see the player follow the shared
+    // noise field or their memory of where the player was (see ZombieBehavior::step).
+    void setPlayerInSight(bool inSight) { playerInSight = inSight; }
+    bool isPlayerInSight() const { return playerInSight; }
+    void setLastKnownPlayerPos(const sf::Vector2f& pos) { lastSeenPlayerPos = Vec2(pos.x, pos.y); }
+
+    // Previous/current position in the shared TransformBuffer (interpolated once per frame by Game)
+    TransformSlot transform;
     // Shadow support: set a shadow texture to render under the zombie
     void setShadowTexture(const sf::Texture& tex) { shadowTexture = &tex; }
 
 protected:
+    template<ZombieType T> friend struct ZombieBehavior;
+
     sf::Sprite sprite;
     std::vector<sf::Texture> walkTextures;
     std::vector<sf::Texture> attackTextures;
     std::vector<sf::Texture> deathTextures;
-    // Optional single-sheet support for walk animation
-    sf::Texture walkSheetTexture;
+    // Optional single-sheet support for walk animation (sheet is shared by all instances of a type)
+    const sf::Texture* walkSheetTexture = nullptr;
     std::vector<sf::IntRect> walkRects;
     bool hasWalkSheet = false;
-    // Optional single-sheet support for attack animation
-    sf::Texture attackSheetTexture;
+    // Optional single-sheet support for attack animation (shared like the walk sheet)
+    const sf::Texture* attackSheetTexture = nullptr;
     std::vector<sf::IntRect> attackRects;
     bool hasAttackSheet = false;
 
@@ -96,8 +122,9 @@ protected:
     // Many sprite sheets face up/down by default; adjust per-zombie type in their constructor.
     float rotationOffset = 0.0f;
 
-    // Last seen player position updated each update; derived classes can use it for attacks
+    // Last position the zombie saw (or was told) the player at; also the lunge target
     Vec2 lastSeenPlayerPos = Vec2(0,0);
+    bool playerInSight = true;
 
     bool attacking;
     int currentAttackFrame;
@@ -116,23 +143,28 @@ protected:
     float health;
     float maxHealth;
 
-    virtual void setState(ZombieState newState);
-    virtual void updateAnimation(float deltaTime);
+    void setState(ZombieState newState);
     virtual void loadTextures() = 0;
 
-    // Hook for derived classes to disable rotation (e.g., during lunges)
-    virtual bool canRotate() const { return true; }
-    // Hook for derived classes to disable base movement logic (e.g., during lunges)
-    virtual bool isMovementLocked() const { return false; }
-
     bool m_hasDealtDamageInAttack;
 
-    // Set by derived classes during attack animation to indicate the active damage frames.
+    // Set by the behaviour update while the attack animation is inside the damage frames
     bool isInDamageWindow = false;
 
+    // Lunge state (used by types whose traits enable lunging)
+    bool lunging = false;
+    Vec2 lungeDir = Vec2(0,0);
+    float lungeTimer = 0.0f;
+    // snapshot of player's position when lunge starts so lunge continues forward
+    Vec2 lungeTargetPos = Vec2(0,0);
+    bool preLungeHandled = false;
+    // Cleared while a lunge has locked the facing direction
+    bool canRotateOverride = true;
+
     void loadTextureSet(std::vector<sf::Texture>& textures, const std::string& basePath,
         const std::string& prefix, int count, bool isBoss = false);
     const sf::Texture* shadowTexture = nullptr;
+    Animator::LOD animLOD = Animator::LOD::Full;
 };
 
 #endif
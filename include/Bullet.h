@@ -1,9 +1,12 @@
 #pragma once
 
 #include "Entity.h"
+#include "TransformBuffer.h"
 #include <unordered_set>
 #include <SFML/Graphics.hpp>
 
+class RenderQueue;
+
 class Bullet : public Entity {
 public:
     Bullet(Vec2 position, Vec2 velocity, float mass = 1.0f, int maxPenetrations = 1, float damage = 25,
@@ -11,10 +14,9 @@ public:
 
     void update(float dt) override;
     void onCollision(Entity* other) override;
-    void render(sf::RenderWindow& window) override; // matches base Entity
-
-    // set interpolation alpha (0..1) before rendering
-    void setRenderAlpha(float a) { renderAlpha = a; }
+    using Entity::render;
+    // Submitted to the world render queue so all bullets merge into one draw call
+    void render(RenderQueue& queue);
 
     static sf::Texture bulletTexture;
     // Runtime visual adjustments
@@ -45,13 +47,11 @@ private:
     sf::Vector2f spriteOffset = sf::Vector2f(-30.f, 0.f);
     float spriteScale = 0.01f;
     float rotationOffset = 0.0f;
+    // Place the sprite at the interpolated position, facing the velocity
+    void updateSpriteTransform();
 
-    // Interpolation positions
-    sf::Vector2f prevPos;
-    sf::Vector2f currPos;
-
-    // interpolation alpha used during render
-    float renderAlpha = 1.0f;
+    // Previous/current position in the shared TransformBuffer
+    TransformSlot transform;
 
     // Lifetime to auto-destroy bullets that miss forever
     float lifeTimer = 0.0f;
@@ -0,0 +1,52 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+class RenderQueue;
+
+// Static map ground split into fixed-size chunks, each kept in its own sf::VertexBuffer (static usage)
+// and built once. Only the chunks intersecting the view are submitted, so the per-frame cost is bounded
+// by the view size rather than the map size. Image maps are cut into one texture per chunk, which lets
+// a map exceed the GPU's maximum texture size.
+class ChunkedMap {
+public:
+    static const unsigned kDefaultChunkSize = 1024;
+
+    // Cover size with a tile texture, one quad per tile (the texture must outlive the map)
+    void buildTiled(const sf::Texture& tile, const sf::Vector2u& size, unsigned chunkSize = kDefaultChunkSize);
+    // Load a map image and cut it into chunk textures owned by the map
+    bool loadImage(const std::string& path, unsigned chunkSize = kDefaultChunkSize);
+    void clear();
+
+    // Submit the visible chunks to RenderLayer::Map. Chunks are never modified after building, so the
+    // commands are safe to replay on the render thread.
+    void submit(RenderQueue& queue, const sf::View& view);
+
+    bool isEmpty() const { return chunks.empty(); }
+    const sf::Vector2u& getSize() const { return size; }
+    size_t getChunkCount() const { return chunks.size(); }
+    size_t getLastVisibleCount() const { return lastVisible; }
+
+private:
+    struct Chunk {
+        sf::FloatRect bounds;
+        const sf::Texture* texture = nullptr;
+        sf::VertexBuffer buffer{ sf::Quads, sf::VertexBuffer::Static };
+        // Used instead of the buffer when the driver has no vertex buffer support
+        sf::VertexArray fallback{ sf::Quads };
+    };
+
+    void beginGrid(const sf::Vector2u& mapSize, unsigned chunk);
+    void upload(Chunk& chunk, const std::vector<sf::Vertex>& vertices);
+
+    // Row-major grid; chunks are heap-allocated so queued commands can keep pointers to them
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<std::unique_ptr<sf::Texture>> chunkTextures;
+    sf::Vector2u size;
+    unsigned chunkSize = kDefaultChunkSize;
+    unsigned columns = 0;
+    unsigned rows = 0;
+    size_t lastVisible = 0;
+};
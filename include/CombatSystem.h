@@ -0,0 +1,58 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <vector>
+#include <cstdint>
+#include "AttackOBB.h"
+
+class Player;
+class BaseZombie;
+
+// Single combat resolution pass per fixed step. Gathers every attack volume (player melee, zombie bites),
+// finds candidates through a uniform grid over the live zombies and applies damage and knockback exactly
+// once per hit: a melee swing damages each zombie it touches once, however many steps it stays active.
+// Side effects owned by Game (points, sounds) are raised through callbacks.
+class CombatSystem {
+public:
+    void setOnZombieKilled(std::function<void(BaseZombie&)> cb) { onZombieKilled = std::move(cb); }
+    void setOnPlayerBitten(std::function<void(BaseZombie&, float)> cb) { onPlayerBitten = std::move(cb); }
+
+    void resolve(Player& player, const std::vector<BaseZombie*>& zombies);
+
+    // Zombie hitboxes tested against attack volumes in the last resolve (after grid culling)
+    int getLastCandidateTests() const { return lastCandidateTests; }
+    // Attack OBBs and occupied grid cells of the last resolve, for DebugDraw
+    void reportDebugShapes() const;
+
+private:
+    std::function<void(BaseZombie&)> onZombieKilled;
+    std::function<void(BaseZombie&, float)> onPlayerBitten;
+
+    // Zombies already hit by the current melee swing (a swing starts when isAttacking() turns true)
+    std::vector<const BaseZombie*> swingHits;
+    bool playerWasAttacking = false;
+    // Attack boxes of the zombies attacking this step (reused between steps to avoid reallocating)
+    std::vector<AttackOBB> zombieAttackBoxes;
+
+    // Uniform grid over live zombie positions, rebuilt every resolve with a counting sort so each
+    // cell's zombies are contiguous in cellItems[cellStart[c] .. cellStart[c+1])
+    float cellSize = 128.0f;
+    int maxCellsPerAxis = 256;
+    float queryPadding = 24.0f; // zombies are binned by centre; pad queries by their hitbox half size
+    sf::Vector2f gridOrigin;
+    int gridCols = 0;
+    int gridRows = 0;
+    std::vector<uint32_t> cellStart;
+    std::vector<BaseZombie*> cellItems;
+    std::vector<uint32_t> itemCell;   // cell of each zombie (scratch)
+    std::vector<uint32_t> cellCursor; // next write slot per cell (scratch)
+    int lastCandidateTests = 0;
+
+    void buildIndex(const std::vector<BaseZombie*>& zombies);
+    int cellX(float x) const;
+    int cellY(float y) const;
+    template<typename Fn> void query(const sf::FloatRect& area, Fn&& fn);
+
+    void resolveZombieBites(Player& player, const std::vector<BaseZombie*>& zombies);
+    void damageZombie(BaseZombie& z, float amount);
+};
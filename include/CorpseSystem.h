@@ -0,0 +1,45 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+
+class RenderQueue;
+
+// Shared death animation for a zombie type (referenced from ZombieTraits, never copied per corpse).
+// There is no death art, so the "animation" topples, shrinks and darkens the zombie's last frame.
+struct CorpseArchetype {
+    float duration;         // seconds from death to being stamped into the ground
+    float toppleDeg;        // extra rotation reached at the end (direction picked per corpse)
+    float endScale;         // scale multiplier reached at the end
+    uint8_t endShade;       // RGB multiplier (0..255) reached at the end
+};
+
+// Short-lived corpses that play their archetype's death animation and are then baked into the
+// persistent ground canvas (Props::Explosion), so dead zombies cost nothing per frame afterwards.
+class CorpseSystem {
+public:
+    // Start a corpse from a snapshot of the zombie's sprite, positioned in world coordinates
+    void spawn(const sf::Sprite& lastFrame, const sf::Vector2f& position, const CorpseArchetype& archetype);
+    void update(float deltaTime);
+    void draw(RenderQueue& queue) const;
+
+    size_t getActiveCount() const { return corpses.size(); }
+    size_t getStampedCount() const { return stampedCount; }
+
+private:
+    struct Corpse {
+        sf::Sprite sprite;
+        const CorpseArchetype* archetype;
+        float baseRotation;
+        sf::Vector2f baseScale;
+        float toppleSign;
+        float age;
+    };
+    std::vector<Corpse> corpses;
+    size_t stampedCount = 0;
+    // Cap on animating corpses; past it the oldest is stamped early so the live set stays bounded
+    size_t maxActive = 256;
+
+    void apply(Corpse& c, float t) const;
+    void stamp(Corpse& c);
+};
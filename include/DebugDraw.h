@@ -0,0 +1,48 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class RenderQueue;
+
+// Debug draw exists in debug builds only. Under NDEBUG (the Release configurations) every call below is
+// an empty inline and isEnabled() is a constant false, so the reporting code compiles out.
+#if !defined(NDEBUG) && !defined(TDCOD_NO_DEBUG_DRAW)
+#define TDCOD_DEBUG_DRAW 1
+#endif
+
+// World-space debug outlines (physics bodies, attack OBBs, culling rects, broadphase cells). While
+// enabled, systems report shapes as they are visited; submit() hands everything collected this frame
+// to the render queue as one line list (one draw call) on RenderLayer::Debug and starts a new frame.
+class DebugDraw {
+public:
+#ifdef TDCOD_DEBUG_DRAW
+    static void setEnabled(bool on);
+    static bool isEnabled() { return enabled; }
+
+    static void line(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Color& color);
+    static void rect(const sf::FloatRect& bounds, const sf::Color& color);
+    static void circle(const sf::Vector2f& center, float radius, const sf::Color& color, int segments = 16);
+    // Box with half extents along axis (unit, local x) and its perpendicular
+    static void obb(const sf::Vector2f& center, const sf::Vector2f& halfExtents, const sf::Vector2f& axis, const sf::Color& color);
+
+    static void submit(RenderQueue& queue);
+    // Lines in the last submitted frame
+    static size_t getLastLineCount() { return lastLineCount; }
+
+private:
+    static bool enabled;
+    static std::vector<sf::Vertex> lines;
+    static size_t lastLineCount;
+#else
+    static void setEnabled(bool) {}
+    static constexpr bool isEnabled() { return false; }
+
+    static void line(const sf::Vector2f&, const sf::Vector2f&, const sf::Color&) {}
+    static void rect(const sf::FloatRect&, const sf::Color&) {}
+    static void circle(const sf::Vector2f&, float, const sf::Color&, int = 16) {}
+    static void obb(const sf::Vector2f&, const sf::Vector2f&, const sf::Vector2f&, const sf::Color&) {}
+
+    static void submit(RenderQueue&) {}
+    static size_t getLastLineCount() { return 0; }
+#endif
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+#include "Vec2.h"
+
+class PhysicsBody;
+class RenderQueue;
+
+// Fixed-capacity pool of enemy (boss) projectiles stored as structure-of-arrays. Projectiles are not
+// Entities and never enter PhysicsWorld: one loop integrates them and tests each against the player
+// and the static geometry only, and one vertex array draws them.
+class EnemyProjectilePool {
+public:
+    static constexpr size_t kCapacity = 1024;
+
+    EnemyProjectilePool();
+
+    // Returns false (and drops the projectile) when the pool is full
+    bool spawn(const Vec2& pos, const Vec2& vel, float radius, float damage, float lifetime);
+    // Fire count projectiles evenly spaced around center; returns how many fit in the pool
+    int spawnRing(const Vec2& center, int count, float speed, float radius, float damage, float lifetime, float angleOffsetRad = 0.0f);
+
+    // Integrate, age and collide every live projectile. Projectiles die on hitting the player, a static
+    // body, leaving bounds or running out of life. Returns the total damage dealt to the player.
+    // playerBody may be null (e.g. player dead) to skip player hits.
+    float update(float deltaTime, const PhysicsBody* playerBody, const std::vector<PhysicsBody*>& staticBodies, const sf::FloatRect& bounds);
+
+    // Writes every live projectile into the vertex array and submits one additive quad per projectile
+    // (the queue merges them into a single draw)
+    void draw(RenderQueue& queue, float renderAlpha);
+    void clear() { count = 0; }
+
+    size_t size() const { return count; }
+    // Optional texture; without one projectiles draw as tinted quads
+    void setTexture(const sf::Texture* tex) { texture = tex; }
+    void setColor(const sf::Color& c) { color = c; }
+
+private:
+    std::array<float, kCapacity> posX;
+    std::array<float, kCapacity> posY;
+    std::array<float, kCapacity> prevX;
+    std::array<float, kCapacity> prevY;
+    std::array<float, kCapacity> velX;
+    std::array<float, kCapacity> velY;
+    std::array<float, kCapacity> radius;
+    std::array<float, kCapacity> damage;
+    std::array<float, kCapacity> life;
+    size_t count = 0;
+
+    const sf::Texture* texture = nullptr;
+    sf::Color color = sf::Color(255, 120, 40);
+    sf::VertexArray vertices;
+
+    // Swap the last live projectile into slot i
+    void removeAt(size_t i);
+};
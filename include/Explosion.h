@@ -2,6 +2,9 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 
+class RenderQueue;
+class ViewCuller;
+
 namespace Props {
 
     struct Particle
@@ -24,7 +27,10 @@ namespace Props {
 
         void initPhysics(void* world) {}
         void update(void* world);
-        void render(sf::RenderWindow& window);
+        // Live particles go to RenderLayer::Particles; finished traces are stamped into the ground canvas
+        void render(RenderQueue& queue);
+        // World area particles can be drawn in (they are discarded past _maxAllowedDrawDistance)
+        sf::FloatRect getBounds() const;
         void setTrace(bool isTrace) { _isTrace = isTrace; }
         void setDecrease(float d) { _decrease = d; }
         void setSpeed(int32_t d) { _max_speed = d; }
@@ -35,16 +41,19 @@ namespace Props {
         // Static management API
         static Explosion* add(float x, float y, float openAngle, float angle, float speed, float size, size_t n, bool blood = false);
         static void updateAll(float dt);
-        static void renderAll(sf::RenderWindow& window);
+        static void renderAll(RenderQueue& queue, ViewCuller& culler);
 
-        // Draw only the persistent ground canvas (call before rendering entities so stains appear under them)
-        static void renderGround(sf::RenderWindow& window);
+        // Submit the visible part of the persistent ground canvas to RenderLayer::GroundDecals
+        static void renderGround(RenderQueue& queue, const sf::View& view);
         // Texture support for blood particles (optional)
         static void setTexture(const sf::Texture& tex);
         // Set ground canvas size (should be called by Game with map pixel size so decals align with world coords)
         static void setGroundCanvasSize(unsigned int width, unsigned int height);
         // Commit remaining particles into ground canvas immediately (called on explosion end)
         void commitToGround();
+        // Bake a sprite (world coordinates) into the ground canvas, e.g. a finished corpse.
+        // The sprite's texture must outlive the call if the canvas isn't created yet (it is queued).
+        static void stampToGround(const sf::Sprite& sprite);
 
     private:
         size_t _n;
@@ -0,0 +1,67 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class RenderQueue;
+
+// Additive muzzle flashes and bullet tracers. Particles live in a fixed-capacity ring buffer (the oldest
+// is overwritten when it is full), age by the simulation dt in update(), and render as one quad batch:
+// the flash image and a generated tracer streak share one texture, so every flash and tracer is a
+// single draw call.
+class FlashEmitter {
+public:
+    static const size_t kCapacity = 64;
+
+    // Flash art, downsampled into the emitter's texture (call with a current GL context, e.g. at load).
+    // Tracers work without one.
+    void setFlashTexture(const sf::Texture& texture);
+
+    // Flash centred on position, facing rotationDeg, at scale times the flash image size
+    void emitFlash(const sf::Vector2f& position, float rotationDeg, float scale, float life);
+    // Streak whose head travels from position at velocity; the tail trails by up to length
+    void emitTracer(const sf::Vector2f& position, const sf::Vector2f& velocity, float life, float length, float width);
+
+    // Age every particle by one simulation step
+    void update(float dt);
+    void clearFlashes();
+    void clear();
+
+    // Render at alpha between the previous and the current step as one RenderLayer::MuzzleEffects item
+    void submit(RenderQueue& queue, float alpha);
+
+    size_t getActiveCount() const { return activeCount; }
+
+private:
+    enum class Kind : uint8_t { None, Flash, Tracer };
+    struct Particle {
+        Kind kind = Kind::None;
+        sf::Vector2f position;
+        sf::Vector2f velocity; // tracers
+        float rotation = 0.0f; // flashes, degrees
+        float size = 1.0f;     // flash scale, or tracer length
+        float width = 1.0f;    // tracers
+        float age = 0.0f;
+        float life = 0.0f;
+    };
+
+    Particle& allocate();
+    void ensureTexture();
+    void buildVertices(float alpha);
+
+    std::array<Particle, kCapacity> particles{};
+    size_t next = 0; // ring write position
+    size_t activeCount = 0;
+    float lastStep = 0.0f;
+
+    // Flash image at the left, tracer streak to its right
+    sf::Texture texture;
+    bool textureReady = false;
+    sf::Image flashCell;       // downsampled flash art
+    float flashSourceWidth = 0.0f;
+    bool hasFlashImage = false;
+    sf::FloatRect flashRect;
+    sf::FloatRect tracerRect;
+    std::vector<sf::Vertex> vertices;
+};
@@ -6,12 +6,21 @@
 #include "Player.h"
 #include "LevelManager.h"
 #include "PhysicsWorld.h"
+#include "CombatSystem.h"
+#include "ViewCuller.h"
+#include "RenderQueue.h"
+#include "RenderThread.h"
+#include "ChunkedMap.h"
+#include "SdfFont.h"
 #include <array>
+#include <string>
 #include <vector>
 
 class Game {
 public:
-    Game();
+    // A non-zero offscreenSize makes the game headless: no window is opened and everything render()
+    // draws goes into an offscreen texture of that size (render benchmarks on machines without a display)
+    explicit Game(const sf::Vector2u& offscreenSize = sf::Vector2u(0, 0));
     void run();
     sf::RenderWindow& getWindow();
     
@@ -20,7 +29,7 @@ public:
     int getPoints() const;
     void reset();
     
-    sf::Sprite& getMapSprite(int level);
+    ChunkedMap& getMap(int level);
     sf::Vector2u getMapSize(int level); // Added to get map size dynamically
 
     // Pause control
@@ -28,17 +37,43 @@ public:
     void setPaused(bool p) { paused = p; }
     void togglePaused() { paused = !paused; }
 
+    // Endless horde stress mode (also reachable via the --horde command-line flag).
+    // maxActive > 0 overrides the configured ceiling on active zombies.
+    void startHorde(int maxActive = 0);
+
+    // Draw the world on a separate render thread from simulation snapshots (the --render-thread flag).
+    // Takes effect when run() starts.
+    void setRenderThreadEnabled(bool enabled) { renderThreadEnabled = enabled; }
+
+    // Scripted render benchmark (the --benchmark flag): a horde run where the player circles the start
+    // point and fires, stepped at a fixed 60 fps with no input. Prints per-pass timings and draw counts;
+    // optionally saves every goldenEvery-th frame to goldenDir as frame_NNNNN.png.
+    struct BenchmarkOptions {
+        int frames = 600;
+        int warmupFrames = 30; // rendered but left out of the report (texture uploads, glyph pages)
+        int hordeMax = 0;      // > 0 overrides the horde's active zombie ceiling
+        unsigned seed = 1;
+        int goldenEvery = 0;
+        std::string goldenDir = ".";
+    };
+    bool runBenchmark(const BenchmarkOptions& options);
+
 private:
     std::vector<std::unique_ptr<Bullet>> bullets;
 
     sf::RenderWindow window;
+    // Headless mode: render() targets offscreen instead of the window
+    bool headless = false;
+    sf::RenderTexture offscreen;
+    sf::RenderTarget& screen();
     Player player;
     LevelManager levelManager;
     PhysicsWorld physics;
     
-    sf::Sprite mapSprite1;
-    sf::Sprite mapSprite2;
-    sf::Sprite mapSprite3;
+    // Map ground, built once into static chunk buffers
+    ChunkedMap map1;
+    ChunkedMap map2;
+    ChunkedMap map3;
     sf::Texture mapTexture1;
     sf::Texture mapTexture2;
     sf::Texture mapTexture3;
@@ -52,22 +87,88 @@ private:
     sf::Text pointsText;
     sf::Font font;
 	sf::Font font2;
+    // Bold distance-field version of font for the large GAME OVER / VICTORY titles
+    SdfFont titleFont;
+    // Rasterize the glyph styles the in-game menus use, before the first menu is shown
+    void prewarmFonts();
     sf::Clock clock;
     sf::View gameView;
+    // Visibility test for the world-space draws, rebuilt from gameView each frame
+    ViewCuller viewCuller;
+    // World-space draw list, flushed once per frame (HUD and screen overlays still draw directly)
+    RenderQueue renderQueue;
+    // Optional render thread for the world pass; renderQueue is unused while it runs
+    RenderThread renderThread;
+    bool renderThreadEnabled = false;
+    // Submit the world at the given interpolation alpha (render() and render-thread snapshots)
+    void submitWorld(RenderQueue& queue, float alpha);
+    float cullPadding = 32.0f;
     // Deferred shooting request filled in processInput and handled in update
     bool shootRequested = false;
     sf::Vector2f shootTarget;
+    // Benchmark script: the aim point replaces the mouse, which is ignored
+    bool scripted = false;
+    sf::Vector2f scriptedAim;
+    sf::Vector2f getWorldMousePosition();
+    bool saveScreenshot(const std::string& path);
 
 	void drawVictoryScreen();
     void processInput();
     void update(float deltaTime);
     void render();
     
-    void checkZombiePlayerCollisions();
+    // Melee, bite and area damage resolution (once per fixed step)
+    CombatSystem combat;
     void checkPlayerBoundaries();
     
     void drawHUD();
 
+    // Profiler timings in ms. frameTimings is filled during one loop iteration (physics/level/ai are summed
+    // over the fixed steps that ran), smoothedTimings feeds the live readout and windowTimings the periodic print.
+    struct ProfilerTimings {
+        double frame = 0.0;
+        double physics = 0.0;
+        double level = 0.0;
+        double ai = 0.0;
+        double reorder = 0.0; // Morton reorder of zombies/physics bodies (F4 toggles it)
+        double render = 0.0;
+    };
+    // CPU time of each render pass in the last render() (the world pass includes composition)
+    std::array<double, static_cast<size_t>(RenderPass::Count)> passMs{};
+    ProfilerTimings frameTimings;
+    ProfilerTimings smoothedTimings;
+    ProfilerTimings windowTimings;
+    uint32_t profilerSamples = 0;
+    // Live performance readout (F3 toggles it; horde mode turns it on)
+    bool showPerfOverlay = false;
+    sf::Text perfText;
+    void drawPerfOverlay();
+    // World-space pieces of render() that follow the player: captured from the current state, drawn by
+    // renderQueue commands, or over the render thread's world one frame later (shift matches its latency)
+    struct PlayerOverlay {
+        bool cone = false;
+        sf::Vertex coneFan[3];
+        sf::Vertex coneSides[4];
+        bool reloadPrompt = false;
+        sf::Vector2f promptPosition;
+        sf::Vector2f shift;
+    };
+    PlayerOverlay captureOverlay();
+    void drawSpreadCone(InstrumentedTarget& target, const PlayerOverlay& overlay);
+    void drawReloadPrompt(InstrumentedTarget& target, const PlayerOverlay& overlay);
+    // Overlay matching the world the render thread is drawing now (shown next frame)
+    PlayerOverlay pendingOverlay;
+    bool pendingOverlayValid = false;
+    // Reload prompt widgets, built once in prompt-local coordinates
+    void buildReloadPrompt();
+    sf::RectangleShape reloadPromptPanel;
+    sf::Sprite reloadPromptKey;
+    sf::RectangleShape reloadPromptKeyBox;
+    sf::Text reloadPromptKeyLetter;
+    sf::Text reloadPromptText;
+    bool reloadPromptBuilt = false;
+    bool reloadPromptHasIcon = false;
+
     sf::Music cutsceneMusic;
     sf::Music backgroundMusic;
     sf::Music waveStartSound;
@@ -136,10 +237,35 @@ private:
     // Render-to-texture for world rendering so we can apply a desaturation shader
     sf::RenderTexture worldRenderTexture;
     sf::Sprite worldTextureSprite;
-    sf::Shader desaturateShader;
-    bool desaturateShaderLoaded = false;
+    bool worldTextureReady = false;
+    // Dynamic resolution: the world renders at worldScale of the window size (HUD stays native)
+    float worldScale = 1.0f;
+    float minWorldScale = 0.5f;
+    float maxWorldScale = 1.0f;
+    float worldScaleStep = 0.05f;
+    float worldScaleHold = 0.0f; // seconds since the scale last changed
+    double frameBudgetMs = 1000.0 / 60.0; // matches setFramerateLimit(60)
+    void updateWorldScale(float deltaTime);
+    // Screen effects applied while compositing the world: health desaturation, blood vignette and the
+    // game over dim, each 0..1
+    struct PostEffects {
+        float desaturate = 0.0f;
+        float blood = 0.0f;
+        float fade = 0.0f;
+    };
+    PostEffects computePostEffects();
+    // Draws the world texture with the post-process shader; returns false when the effects still have
+    // to be drawn as overlays (no shader support)
+    bool compositeWorld(const sf::Texture& texture, const sf::FloatRect& viewport, const PostEffects& post);
+    void drawPostOverlays(InstrumentedTarget& target, const PostEffects& post);
+    sf::Shader postShader;
+    bool postShaderLoaded = false;
     // Exponent controlling desaturation curve: higher -> slower ramp for mid-health values
     float desaturatePow = 2.5f;
+    // Strongest desaturation at zero health so the world never goes fully gray
+    float desaturateMax = 0.6f;
+    // How dark the world gets behind the game over title once it has faded in
+    float gameOverDimMax = 0.5f;
 
     // Muzzle flash texture (placeholder path will be used in Game.cpp)
     sf::Texture muzzleFlashTexture;
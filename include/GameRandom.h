@@ -0,0 +1,17 @@
+#pragma once
+#include <random>
+
+// Gameplay random source shared by zombie spawning, bullet spread and muzzle-flash jitter. Seeded from
+// std::random_device at first use; the render benchmark reseeds it (with std::srand for the rand()
+// based effects) so scripted runs with the same --seed lay out and play the same horde.
+namespace GameRandom {
+
+    inline std::mt19937& engine() {
+        static std::mt19937 gen(std::random_device{}());
+        return gen;
+    }
+
+    inline void seed(unsigned value) {
+        engine().seed(value);
+    }
+}
@@ -5,6 +5,9 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 
+class RenderQueue;
+class ViewCuller;
+
 class Guts : public Entity {
 public:
     Guts();
@@ -14,7 +17,11 @@ public:
 
     // Project-style API: update and render accept simple parameters
     void update(float dt);
-    void render(sf::RenderWindow& window);
+    using Entity::render;
+    // Particles as RenderLayer::Particles quads
+    void render(RenderQueue& queue);
+    // Box around all particles
+    sf::FloatRect getBounds() const;
     void kill();
 
     static void init();
@@ -22,7 +29,7 @@ public:
     // Static management
     static void add(const Vec2& pos, const Vec2& vel);
     static void updateAll(float dt);
-    static void renderAll(sf::RenderWindow& window);
+    static void renderAll(RenderQueue& queue, ViewCuller& culler);
 
     // Allow external code to provide a texture loaded by Game
     static void setTexture(const sf::Texture& tex);
@@ -12,6 +12,13 @@
 #include "Player.h"
 #include "ZombieWalker.h"
 #include "Bullet.h"
+#include "NoiseField.h"
+#include "EnemyProjectilePool.h"
+#include "CorpseSystem.h"
+#include "RenderQueue.h"
+#include "ShadowBarRenderer.h"
+#include "RetainedHud.h"
+#include "ViewCuller.h"
 #include <chrono>
 #include <iomanip>
 
@@ -23,6 +30,7 @@ enum class GameState {
     LEVEL4,
     LEVEL5,
     BOSS_FIGHT,
+    HORDE,
     GAME_OVER,
     VICTORY
 };
@@ -42,10 +50,11 @@ public:
     
     void initialize();
     void update(float deltaTime, Player& player);
-    void draw(sf::RenderWindow& window);
+    // World-space draws skip anything outside the culler's view rect
+    void draw(RenderQueue& queue, ViewCuller& culler);
     
-    void render(sf::RenderWindow& window);
-    void renderUI(sf::RenderWindow& window, sf::Font& font);
+    void render(RenderQueue& queue, ViewCuller& culler);
+    void renderUI(sf::RenderTarget& window, sf::Font& font);
     void nextLevel();
     void reset();
     
@@ -72,19 +81,43 @@ public:
         // Walk animation frame time in seconds (lower = faster animation)
         float animSpeed = 0.1f;
     };
+    // Endless horde mode: active zombie target ramps from startCount by rampPerSecond up to maxActive
+    struct HordeConfig {
+        int startCount = 40;
+        float rampPerSecond = 15.0f;
+        int maxActive = 3000;
+        // Upper bound on pool activations per fixed step so ramp-up doesn't spike a single frame
+        int activatePerStep = 24;
+        // Pool grows in chunks of this many zombies as the target rises
+        int poolGrowChunk = 128;
+        float health = 40.0f;
+        float damage = 10.0f;
+        float speed = 70.0f;
+        float animSpeed = 0.1f;
+    };
     void setTutorialConfig(const ZombieRoundConfig& cfg) { tutorialConfig = cfg; }
     void setRoundConfig(int roundIndex, const ZombieRoundConfig& cfg) { if (roundIndex >= 0 && roundIndex < (int)roundConfigs.size()) roundConfigs[roundIndex] = cfg; }
     
+    // Start the endless horde stress mode around the given player position
+    void startHorde(const sf::Vector2f& playerPos);
+    void setHordeConfig(const HordeConfig& cfg) { hordeConfig = cfg; }
+    const HordeConfig& getHordeConfig() const { return hordeConfig; }
+    int getHordeTargetCount() const;
+    float getHordeElapsed() const { return hordeElapsed; }
+
     void updateZombies(float deltaTime, const Player& player);
-    void drawZombies(sf::RenderWindow& window) const;
+    void drawZombies(RenderQueue& queue, ViewCuller& culler);
     std::vector<BaseZombie*>& getZombies();
 
     // Render bullets managed by Game (LevelManager will draw them so ordering is managed centrally)
-    void renderBullets(sf::RenderWindow& window, std::vector<std::unique_ptr<Bullet>>& bullets, float renderAlpha);
+    void renderBullets(RenderQueue& queue, std::vector<std::unique_ptr<Bullet>>& bullets, ViewCuller& culler);
+    // Boss projectiles (pooled, outside PhysicsWorld); simulated during BOSS_FIGHT only
+    EnemyProjectilePool& getEnemyProjectiles() { return enemyProjectiles; }
+    void renderEnemyProjectiles(RenderQueue& queue, float renderAlpha);
 
-    void drawHUD(sf::RenderWindow& window, const Player& player);
+    void drawHUD(sf::RenderTarget& window, const Player& player);
     
-    void showTutorialDialog(sf::RenderWindow& window);
+    void showTutorialDialog(sf::RenderTarget& window);
     void advanceDialog();
     
     sf::Vector2f getMapSize() const;
@@ -94,7 +127,9 @@ public:
     // can place zombies just outside the visible area.
     void setCameraViewRect(const sf::FloatRect& viewRect);
     // Shadow support: set a texture that will be assigned to spawned zombies
-    void setShadowTexture(const sf::Texture& tex) { shadowTexture = &tex; }
+    void setShadowTexture(const sf::Texture& tex) { shadowTexture = &tex; shadowBars.setShadowTexture(&tex); }
+    // Shadows queued here before render() are drawn in the same pass as the zombies' (e.g. the player's)
+    ShadowBarRenderer& getShadowBarRenderer() { return shadowBars; }
     // HUD weapon icons (set by Game when loading assets)
     void setPistolIcon(const sf::Texture& tex) { pistolIcon = &tex; }
     void setRifleIcon(const sf::Texture& tex) { rifleIcon = &tex; }
@@ -120,7 +155,24 @@ public:
     void notifyPlayerDeath();
     int getActiveZombieCount() const { return static_cast<int>(zombies.size()); }
     int getQueuedZombieCount() const { return static_cast<int>(zombiesToSpawn.size()); }
+    int getPooledZombieCount() const { return static_cast<int>(zombiePool.size()); }
+    // Time spent in the last updateZombies call (zombie AI/animation), for the profiler
+    double getLastZombieUpdateMs() const { return lastZombieUpdateMs; }
     bool getDebugLogging() const { return debugLogging; }
+    // Animation LOD: off-screen zombies only advance frame counters, distant on-screen ones animate at half rate
+    void setAnimationLODEnabled(bool enabled) { animationLODEnabled = enabled; }
+    bool isAnimationLODEnabled() const { return animationLODEnabled; }
+    // Periodic Z-order sort of the active zombie list and the physics dynamic bodies so spatial
+    // neighbours are iterated together. Toggle to compare AI/physics timings with and without it.
+    void setMortonOrderingEnabled(bool enabled) { mortonOrderingEnabled = enabled; }
+    bool isMortonOrderingEnabled() const { return mortonOrderingEnabled; }
+    // Shared gunshot noise field. With noise perception on, zombies outside the (padded) camera view
+    // can't see the player and instead follow the field's gradient or their last known position.
+    NoiseField& getNoiseField() { return noiseField; }
+    void setNoisePerceptionEnabled(bool enabled) { noisePerceptionEnabled = enabled; }
+    bool isNoisePerceptionEnabled() const { return noisePerceptionEnabled; }
+    // Time spent reordering during the last step (0 when no reorder ran), for the profiler
+    double getLastMortonReorderMs() const { return lastMortonReorderMs; }
 
 private:
     PhysicsWorld* physicsWorld = nullptr;
@@ -196,6 +248,41 @@ private:
     ZombieRoundConfig tutorialConfig;
     std::array<ZombieRoundConfig,5> roundConfigs;
 
+    HordeConfig hordeConfig;
+    float hordeElapsed = 0.0f;
+    // Queue off-screen spawn requests around the player for the horde ramp
+    void queueHordeSpawns(int count, const sf::Vector2f& playerPos);
+    void updateHorde(float deltaTime, Player& player);
+    double lastZombieUpdateMs = 0.0;
+
+    NoiseField noiseField;
+    EnemyProjectilePool enemyProjectiles;
+    // Dead zombies animate briefly here and are then baked into the ground canvas
+    CorpseSystem corpses;
+    // Zombie (and player) shadows plus zombie health bars, submitted as one queue item each
+    ShadowBarRenderer shadowBars;
+    // Bars and weapon panels, rebuilt only when the values they show change
+    RetainedHud playerHud;
+    // Zombie counter text, kept between frames so its string is only re-set on a count change
+    sf::Text zombieCountText;
+    bool zombieCountTextReady = false;
+    size_t shownZombieCount = static_cast<size_t>(-1);
+    bool shownZombieCountHorde = false;
+    // Zombies that passed culling this frame (reused to avoid reallocating)
+    std::vector<BaseZombie*> visibleZombies;
+    bool noisePerceptionEnabled = true;
+    float noiseFieldPadding = 1024.0f; // grid extends past the map so off-map spawns can hear too
+
+    // Morton ordering of zombies/physics bodies (see setMortonOrderingEnabled)
+    bool mortonOrderingEnabled = true;
+    float mortonReorderInterval = 0.25f;   // seconds between reorder passes
+    size_t mortonMaxMovesPerPass = 4096;   // bounds each pass; unfinished work continues next pass
+    float mortonCellSize = 32.0f;          // world units per grid cell when quantizing positions
+    float mortonReorderTimer = 0.0f;
+    std::vector<uint32_t> mortonKeys;
+    double lastMortonReorderMs = 0.0;
+    void reorderByMorton();
+
     // Initializes the default per-round configs. Edit the values in the implementation
     // in LevelManager.cpp under the clearly marked "CONFIGURABLE ROUND SETTINGS" region.
     void initializeDefaultConfigs();
@@ -221,6 +308,11 @@ private:
     // Debugging
     bool debugLogging = false;
 
+    // Animation LOD tuning
+    bool animationLODEnabled = true;
+    float animLODViewPadding = 80.0f;        // world units added around the camera rect (sprite extents)
+    float animLODHalfRateDistance = 550.0f;  // on-screen zombies farther than this from the player animate at half rate
+
     // Health damage flash: when player loses health show the missing portion as red briefly
     float prevFrameHealthPercent = 1.0f; // health percent observed previous frame
     float damageFlashStartPercent = 1.0f; // percent before damage
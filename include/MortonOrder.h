@@ -0,0 +1,63 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+// Z-order (Morton) helpers used to keep entity arrays roughly sorted by position, so that
+// entities close together in the world are also close together in iteration order.
+namespace Morton {
+
+    // Spread the low 16 bits of v so there is a zero bit between each of them
+    inline uint32_t part1By1(uint32_t v) {
+        v &= 0x0000ffffu;
+        v = (v | (v << 8)) & 0x00ff00ffu;
+        v = (v | (v << 4)) & 0x0f0f0f0fu;
+        v = (v | (v << 2)) & 0x33333333u;
+        v = (v | (v << 1)) & 0x55555555u;
+        return v;
+    }
+
+    inline uint32_t encode(uint32_t x, uint32_t y) {
+        return part1By1(x) | (part1By1(y) << 1);
+    }
+
+    // Quantize a world position onto a 65536x65536 grid of cellSize cells starting at origin
+    inline uint32_t key(float x, float y, float originX, float originY, float cellSize) {
+        float fx = (x - originX) / cellSize;
+        float fy = (y - originY) / cellSize;
+        uint32_t qx = static_cast<uint32_t>(std::clamp(fx, 0.0f, 65535.0f));
+        uint32_t qy = static_cast<uint32_t>(std::clamp(fy, 0.0f, 65535.0f));
+        return encode(qx, qy);
+    }
+
+    // Insertion sort of items by key, stopping after maxMoves element moves. Entities only move a
+    // little between calls, so the array stays nearly sorted and this is close to a linear scan.
+    // If the move budget runs out the remaining work is picked up on the next call.
+    // keys is caller-owned scratch so no allocation happens once it has grown.
+    // Returns true when the array ended fully ordered.
+    template<typename T, typename KeyFn>
+    bool incrementalSort(std::vector<T>& items, std::vector<uint32_t>& keys, KeyFn keyOf, size_t maxMoves) {
+        const size_t n = items.size();
+        keys.resize(n);
+        for (size_t i = 0; i < n; ++i) keys[i] = keyOf(items[i]);
+
+        size_t moves = 0;
+        for (size_t i = 1; i < n; ++i) {
+            if (keys[i - 1] <= keys[i]) continue;
+            T item = items[i];
+            uint32_t k = keys[i];
+            size_t j = i;
+            while (j > 0 && keys[j - 1] > k) {
+                items[j] = items[j - 1];
+                keys[j] = keys[j - 1];
+                --j;
+                if (++moves >= maxMoves) break;
+            }
+            items[j] = item;
+            keys[j] = k;
+            if (moves >= maxMoves) return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+// Coarse grid of "loudness" values shared by all zombies. Gunshots stamp a disc of noise around the
+// muzzle; the grid then diffuses and decays at a low fixed tick rate. Zombies that cannot see the player
+// walk up the gradient, so the cost is per grid cell rather than per zombie perception query.
+class NoiseField {
+public:
+    // Cover the rectangle [origin, origin + size). Reallocates (and clears) only when the extent changes.
+    void setBounds(const sf::Vector2f& origin, const sf::Vector2f& size);
+
+    // Add noise centred at pos; loudness is the peak value, radius is in world units (linear falloff)
+    void emit(const sf::Vector2f& pos, float loudness, float radius);
+
+    // Advance diffusion/decay; runs whole ticks of 1/tickRate seconds
+    void update(float deltaTime);
+    void clear();
+
+    float sample(const sf::Vector2f& pos) const;
+    // Central-difference gradient (points towards louder cells); zero outside the grid
+    sf::Vector2f gradient(const sf::Vector2f& pos) const;
+
+    // Values below this are treated as silence
+    float getAudibleThreshold() const { return audibleThreshold; }
+    int getCellCount() const { return cols * rows; }
+
+private:
+    sf::Vector2f origin;
+    sf::Vector2f size;
+    float cellSize = 64.0f;
+    int cols = 0;
+    int rows = 0;
+    std::vector<float> cells;
+    std::vector<float> scratch;
+
+    float tickRate = 10.0f;          // diffusion steps per second
+    float diffusion = 0.5f;          // fraction of a cell replaced by its neighbour average each tick
+    float decay = 0.93f;             // multiplier per tick (~1 s half-life)
+    float audibleThreshold = 0.05f;
+    float tickAccumulator = 0.0f;
+
+    int index(int cx, int cy) const { return cy * cols + cx; }
+    float valueAt(int cx, int cy) const;
+    void tick();
+};
@@ -19,17 +19,7 @@ public:
 
     void update(float dt);
     void applyDamping(float factor);
-    sf::Shape& getShape(); // returns a reference to an internally stored shape
-    const sf::Shape& getShape() const;
 
-    sf::CircleShape& getCircleShape();
-    const sf::CircleShape& getCircleShape() const;
-
-    sf::RectangleShape& getRectShape();
-    const sf::RectangleShape& getRectShape() const;
-
-
-private:
-    sf::CircleShape circleShape;
-    sf::RectangleShape rectShape;
+    // Outline of the collision shape for DebugDraw (nothing in release builds)
+    void reportDebugShape() const;
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 #include "PhysicsBody.h"
 #include "Entity.h"
 
@@ -18,9 +19,30 @@ public:
     int getDynamicBodyCount() const { return static_cast<int>(dynamicBodies.size()); }
     int getStaticBodyCount() const { return static_cast<int>(staticBodies.size()); }
     int getLastCollisionChecks() const { return lastCollisionChecks; }
+    // Outline every body for DebugDraw
+    void reportDebugShapes() const;
+
+    // Reorder dynamic bodies along a Z-order curve of their position so bodies that are close in
+    // space are visited close together by the collision loops. Moves at most maxMoves entries per
+    // call; returns true once the array is fully ordered. The broadphase adopts the same grid, so an
+    // ordered array is already in broadphase cell order.
+    bool reorderDynamicBodiesByMorton(float originX, float originY, float cellSize, size_t maxMoves);
 
 private:
+    // Broadphase record, stored contiguously in Morton cell order: the cell key plus everything the
+    // cheap overlap reject needs, so neighbour scans don't touch the bodies themselves
+    struct BroadphaseEntry {
+        uint32_t cell;
+        float x, y;
+        float halfExtent;
+        PhysicsBody* body;
+    };
+
+    // Fill and sort broadphase; returns the cell size used
+    float buildBroadphase();
     void resolveCollisions();
+    // Narrow phase, collision response and game callbacks for one ordered dynamic pair
+    void resolveDynamicPair(PhysicsBody* a, PhysicsBody* b);
     bool isColliding(PhysicsBody* a, PhysicsBody* b);
     bool isCircleCircle(PhysicsBody* a, PhysicsBody* b);
     bool isCircleAABB(PhysicsBody* circle, PhysicsBody* box);
@@ -32,4 +54,11 @@ private:
     // Debugging fields
     bool debugLogging = false;
     int lastCollisionChecks = 0;
+    // Scratch keys reused by reorderDynamicBodiesByMorton
+    std::vector<uint32_t> mortonKeys;
+    // Broadphase grid: origin and smallest cell (doubled until the largest body fits in one cell)
+    float gridOriginX = -4096.0f;
+    float gridOriginY = -4096.0f;
+    float gridCellSize = 32.0f;
+    std::vector<BroadphaseEntry> broadphase;
 };
\ No newline at end of file
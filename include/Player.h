@@ -9,6 +9,12 @@
 #include <vector>
 #include <array>
 #include "Animator.h"
+#include "FlashEmitter.h"
+#include "TransformBuffer.h"
+
+class NoiseField;
+class RenderQueue;
+class ShadowBarRenderer;
 
 enum class PlayerState {
     IDLE,
@@ -35,11 +41,19 @@ public:
     Player(Vec2 position);
 
     void update(float deltaTime, sf::RenderWindow& window, sf::Vector2u mapSize, sf::Vector2f worldMousePosition);
-    void draw(sf::RenderWindow& window);
-    void render(sf::RenderWindow& window);
+    using Entity::render;
+    // Feet and torso as RenderLayer::Player sprites, muzzle flashes and tracers as one
+    // RenderLayer::MuzzleEffects batch (debug markers are reported to DebugDraw)
+    void render(RenderQueue& queue);
+    // Sprite origins, hitbox, muzzle markers and spread outline for DebugDraw
+    void reportDebugShapes() const;
     void attack();
     void takeDamage(float amount);
     void kill();
+    // Ignore damage (scripted benchmark runs keep the player alive)
+    void setInvulnerable(bool on) { invulnerable = on; }
+    // Ignore the movement keys (scripted benchmark runs drive the player themselves)
+    void setKeyboardEnabled(bool on) { keyboardEnabled = on; }
 
     void setPosition(float x, float y);
     sf::Vector2f getPosition() const;
@@ -84,6 +98,8 @@ public:
 
     // Return the world-space muzzle position for the current weapon given an aim target
     sf::Vector2f getMuzzlePosition(const sf::Vector2f& aimTarget) const;
+    // Movement over the last fixed step (current minus previous position)
+    sf::Vector2f getMotion() const { return transform.getMotion(); }
 
     // Reloading
     void startReload();
@@ -122,17 +138,26 @@ public:
     float upperOriginOffsetX = -55.0f;
     float upperOriginOffsetY = 18.0f;
 
-    // When true, render small markers at the upper and feet sprite origins to help align sprites visually
+    // When true, report markers at the upper and feet sprite origins (and muzzle spawns) to DebugDraw
     bool debugDrawOrigins = false;
 
     // Optional muzzle flash texture (set via setter). If set, muzzle flashes will use this texture
     // rendered with additive blending. Texture lifetime must outlive Player.
     const sf::Texture* muzzleTexture = nullptr;
-    void setMuzzleTexture(const sf::Texture& tex) { muzzleTexture = &tex; }
+    void setMuzzleTexture(const sf::Texture& tex) { muzzleTexture = &tex; muzzleEffects.setFlashTexture(tex); }
 
     // Shadow support: texture pointer stored on the player (must outlive Player)
     const sf::Texture* shadowTexture = nullptr;
     void setShadowTexture(const sf::Texture& tex) { shadowTexture = &tex; }
+    // Queue the shadow into the shared shadow pass (render() no longer draws it)
+    void drawShadow(ShadowBarRenderer& overlays) const;
+
+    // Gunshots are stamped into this field (owned by LevelManager) so zombies out of sight hear them
+    NoiseField* noiseField = nullptr;
+    void setNoiseField(NoiseField* field) { noiseField = field; }
+    float shotNoiseLoudness = 1.0f;
+    float shotNoiseRadiusPistol = 900.0f; // world units
+    float shotNoiseRadiusRifle = 1200.0f;
 
     // Sound buffer setters (Game should load buffers and pass them here)
     void setPistolSoundBuffer(const sf::SoundBuffer& buf);
@@ -172,19 +197,11 @@ public:
     sf::Vector2f muzzleOffsetPistol = sf::Vector2f(45.0f, 14.0f);
     sf::Vector2f muzzleOffsetRifle = sf::Vector2f(60.0f, 11.0f);
 
-    // Interpolation positions for smooth rendering
-    sf::Vector2f prevPos = sf::Vector2f(0.f, 0.f);
-    sf::Vector2f currPos = sf::Vector2f(0.f, 0.f);
-    float renderAlpha = 1.0f;
-    void setRenderAlpha(float a) { renderAlpha = a; }
+    // Previous/current position in the shared TransformBuffer (interpolated once per frame by Game)
+    TransformSlot transform;
 
-    // Active muzzle flashes spawned when shooting
-    struct MuzzleFlash {
-        sf::Sprite sprite;
-        float life = 0.0f; // remaining life in seconds
-        float maxLife = 0.0f;
-    };
-    std::vector<MuzzleFlash> activeMuzzles;
+    // Muzzle flashes and bullet tracers spawned when shooting
+    FlashEmitter muzzleEffects;
 
     // Tuning for muzzle flashes
     float muzzleFlashLife = 0.07f; // seconds (increased for visibility)
@@ -194,6 +211,11 @@ public:
     // Optional random jitter applied to flash rotation (+/- degrees)
     float muzzleFlashRotationJitterDeg = 0.0f;
 
+    // Tuning for bullet tracers (a streak riding ahead of each bullet for a few frames)
+    float tracerLife = 0.06f;   // seconds
+    float tracerLength = 70.0f; // pixels
+    float tracerWidth = 3.0f;   // pixels
+
 private:
     void loadTextures();
     void updateAnimation(float deltaTime);
@@ -252,6 +274,8 @@ private:
     float meleeAttackCooldown = 0.8f;
 
     bool dead;
+    bool invulnerable = false;
+    bool keyboardEnabled = true;
     int currentDeathFrame;
     float deathTimer;
     float deathFrameTime;
@@ -0,0 +1,93 @@
+#pragma once
+#include "RenderStats.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// World draw layers, back to front. Adding a layer means adding an entry here, not editing Game::render.
+enum class RenderLayer : uint8_t {
+    Map,
+    GroundDecals,
+    Corpses,
+    Shadows,
+    Zombies,
+    ZombieFlashes,
+    HealthBars,
+    SpreadCone,
+    Player,
+    Bullets,
+    MuzzleEffects,
+    EnemyProjectiles,
+    WorldPrompts,
+    Particles,
+    Debug
+};
+
+// Deferred world-space draw list. Systems submit quads or draw commands with a 64-bit sort key
+//   [63..56 layer | 55..52 blend | 51..32 texture | 31..0 depth]
+// flush() radix-sorts the keys (stable, so equal keys keep submission order), then draws in order and
+// merges runs of adjacent quad items that share texture and blend mode into a single draw call.
+// Blend and texture only enter the key on layers where draw order within the layer doesn't show
+// (map tiles, shadows, bars, bullets, additive effects); every other layer keeps painter's order, so
+// overlapping zombies, corpses and particles stack the way they were submitted.
+class RenderQueue {
+public:
+    using Command = std::function<void(InstrumentedTarget&)>;
+
+    void clear();
+
+    // Quads (4 vertices each, sf::Quads order) copied into the queue
+    void submitQuads(RenderLayer layer, const sf::Texture* texture, const sf::BlendMode& blend,
+                     const sf::Vertex* vertices, size_t vertexCount, uint32_t depth = 0);
+    // The sprite's current frame as one quad
+    void submitSprite(RenderLayer layer, const sf::Sprite& sprite, const sf::BlendMode& blend = sf::BlendAlpha, uint32_t depth = 0);
+    // Anything that isn't a plain quad (text, shapes, systems with their own draw code). Breaks merging.
+    void submitCommand(RenderLayer layer, Command command, uint32_t depth = 0);
+
+    // Movement over the last fixed step (current minus previous position) attached to the following
+    // submissions until reset to zero. Only used when the queue is a snapshot for the render thread.
+    void setMotion(const sf::Vector2f& motion) { currentMotion = motion; }
+    // Move every item back along its motion by (1 - alpha), i.e. to prev + (curr - prev) * alpha
+    void interpolate(float alpha);
+
+    // Sort, draw everything (counted as RenderPass::World) and clear
+    void flush(sf::RenderTarget& target);
+
+    // Stats of the last flush
+    size_t getLastItemCount() const { return lastItemCount; }
+    int getLastDrawCalls() const { return lastDrawCalls; }
+
+private:
+    struct Item {
+        uint32_t first;    // first vertex, or command index
+        uint32_t count;    // vertex count; 0 for commands
+        const sf::Texture* texture;
+        uint8_t blendId;
+        sf::Vector2f motion;
+    };
+    std::vector<Item> items;
+    std::vector<uint64_t> keys;
+    std::vector<sf::Vertex> vertices;
+    std::vector<Command> commands;
+
+    // Radix sort scratch: item indices ordered by key
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> orderScratch;
+    // Contiguous copy of a merged run's vertices
+    std::vector<sf::Vertex> mergeBuffer;
+
+    // Small ids for the key, assigned in first-submission order and reset by clear()
+    std::unordered_map<const sf::Texture*, uint32_t> textureIds;
+    std::vector<sf::BlendMode> blendModes;
+
+    sf::Vector2f currentMotion;
+
+    size_t lastItemCount = 0;
+    int lastDrawCalls = 0;
+
+    uint64_t makeKey(RenderLayer layer, uint8_t blendId, const sf::Texture* texture, uint32_t depth);
+    uint8_t blendIdOf(const sf::BlendMode& blend);
+    void sortByKey();
+};
@@ -0,0 +1,78 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+// Named passes the draw counters are grouped by
+enum class RenderPass : uint8_t {
+    World,    // render queue flush, world composite and world-space overlays
+    Hud,      // screen-space HUD, health overlays, cursor and perf readout
+    Menus,    // pause, controls, settings, game over and victory screens
+    Cutscene, // intro cutscene and main menu
+    Count
+};
+
+struct DrawCounters {
+    uint32_t draws = 0;
+    uint32_t vertices = 0;
+    uint32_t textureChanges = 0;
+    uint32_t blendChanges = 0;
+};
+
+// Per-pass draw statistics. InstrumentedTargets add their counts when they go out of scope (from any
+// thread, the render thread included); endFrame() closes the frame once per main loop iteration.
+class RenderStats {
+public:
+    struct Averages {
+        double draws = 0.0;
+        double vertices = 0.0;
+        double textureChanges = 0.0;
+        double blendChanges = 0.0;
+    };
+
+    static RenderStats& instance();
+
+    void add(RenderPass pass, const DrawCounters& counters);
+    void endFrame();
+
+    // Counts of the last finished frame and their moving average (same smoothing as the frame timings)
+    const DrawCounters& getFrame(RenderPass pass) const { return lastFrame[static_cast<size_t>(pass)]; }
+    const Averages& getAverage(RenderPass pass) const { return average[static_cast<size_t>(pass)]; }
+    static const char* getName(RenderPass pass);
+
+private:
+    static constexpr size_t kPassCount = static_cast<size_t>(RenderPass::Count);
+    std::mutex mutex;
+    std::array<DrawCounters, kPassCount> current{};
+    std::array<DrawCounters, kPassCount> lastFrame{};
+    std::array<Averages, kPassCount> average{};
+};
+
+// Thin facade over an sf::RenderTarget for one pass: forwards every draw and counts draws, vertices and
+// texture/blend changes between consecutive draws. Render code draws through one of these instead of
+// the window (or target) directly.
+class InstrumentedTarget {
+public:
+    InstrumentedTarget(sf::RenderTarget& target, RenderPass pass);
+    ~InstrumentedTarget();
+    InstrumentedTarget(const InstrumentedTarget&) = delete;
+    InstrumentedTarget& operator=(const InstrumentedTarget&) = delete;
+
+    void draw(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::VertexBuffer& buffer, const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+              const sf::RenderStates& states = sf::RenderStates::Default);
+
+    sf::RenderTarget& getTarget() { return target; }
+
+private:
+    void count(std::size_t vertexCount, const sf::Texture* texture, const sf::BlendMode& blend);
+
+    sf::RenderTarget& target;
+    RenderPass pass;
+    DrawCounters counters;
+    bool hasState = false;
+    const sf::Texture* lastTexture = nullptr;
+    sf::BlendMode lastBlend;
+};
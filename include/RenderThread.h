@@ -0,0 +1,86 @@
+#pragma once
+#include "RenderQueue.h"
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Optional world-pass render thread (--render-thread).
+//
+// Each frame the simulation thread records the world into a snapshot: a RenderQueue built at the latest
+// fixed step, whose moving items carry their motion over that step (RenderQueue::setMotion), so the
+// snapshot holds both the previous and the current step. publish() swaps it into the published slot, and
+// the render thread swaps that into its working queue (no copy), interpolates it at the frame's
+// renderAlpha and flushes it into an offscreen texture while the simulation thread moves on to the next
+// frame. The main thread composites the last finished texture under the HUD, so the world is
+// shown one frame later than in single-threaded mode (Game draws the player overlays from the state
+// captured with the shown snapshot to match).
+//
+// Limitation: exchange() waits for the frame in flight, so a world frame that takes longer than the
+// simulation and HUD of the next frame still stalls the main loop, including fixed-step catch-up. The
+// thread overlaps one frame of world drawing with simulation; it does not decouple the two rates.
+//
+// Snapshots must not reference simulation state: commands in them may only capture by value, and every
+// texture they use must outlive the thread (map, sheets, atlas pages, the ground canvas).
+class RenderThread {
+public:
+    RenderThread() = default;
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+    ~RenderThread();
+
+    // Creates the two offscreen targets (window size) and starts the thread
+    bool start(const sf::Vector2u& size);
+    void stop();
+    bool isRunning() const { return thread.joinable(); }
+
+    // Simulation side: record into beginSnapshot() (cleared on publish), then publish it with the
+    // camera it was recorded for
+    RenderQueue& beginSnapshot() { return recording; }
+    void publish(const sf::View& view);
+
+    // Main thread, once per frame: waits for the frame in flight, starts rendering the snapshot published
+    // since the last call (if any) at alpha and returns the texture that finished last
+    const sf::Texture& exchange(float alpha);
+
+    // Stats of the last finished frame (valid after exchange)
+    size_t getLastItemCount() const { return shownItemCount; }
+    int getLastDrawCalls() const { return shownDrawCalls; }
+    // Viewport the shown texture was rendered with (dynamic resolution draws into its top-left part)
+    const sf::FloatRect& getShownViewport() const { return shownViewport; }
+
+private:
+    void threadMain();
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;     // render thread: a frame was requested or stop() was called
+    std::condition_variable finished; // main thread: the requested frame is done
+
+    // Triple-buffered snapshot, rotated by swaps: the simulation records into one, one waits published and
+    // the render thread draws the third. The spare that comes back to recording is cleared on publish.
+    RenderQueue recording;
+    RenderQueue published;
+    sf::View publishedView;
+    bool hasPublished = false; // published holds a snapshot the render thread has not taken yet
+    // Render thread's snapshot, interpolated and consumed by flush
+    RenderQueue working;
+
+    // The main thread composites targets[front]; the render thread draws into the other one
+    sf::RenderTexture targets[2];
+    int front = 0;
+
+    bool quit = false;
+    bool requested = false;
+    bool busy = false;
+    bool frameInFlight = false;
+    float requestedAlpha = 1.0f;
+
+    // Written by the render thread under the mutex, copied for the main thread in exchange()
+    size_t renderedItemCount = 0;
+    int renderedDrawCalls = 0;
+    size_t shownItemCount = 0;
+    int shownDrawCalls = 0;
+    sf::FloatRect renderedViewport = sf::FloatRect(0.f, 0.f, 1.f, 1.f);
+    sf::FloatRect shownViewport = sf::FloatRect(0.f, 0.f, 1.f, 1.f);
+};
@@ -0,0 +1,102 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+class InstrumentedTarget;
+
+// Values shown by the player HUD (health/stamina bars and the two weapon panels)
+struct HudValues {
+    float health = 1.0f;          // 0..1
+    float stamina = 1.0f;         // 0..1
+    float damageFlashEdge = 0.0f; // right edge of the red damage flash (0..1); none when <= health
+    bool rifleEquipped = false;
+    int topAmmo = 0;              // equipped weapon
+    int topMag = 0;
+    int bottomAmmo = 0;           // holstered weapon
+    int bottomMag = 0;
+};
+
+// Fonts, icons and icon scales the HUD is built from (owned elsewhere)
+struct HudResources {
+    const sf::Font* font = nullptr;
+    const sf::Texture* pistolIcon = nullptr;
+    const sf::Texture* rifleIcon = nullptr;
+    const sf::Texture* keyIcon1 = nullptr; // equips the rifle
+    const sf::Texture* keyIcon2 = nullptr; // equips the pistol
+    float pistolTopScale = 1.0f;
+    float pistolBottomScale = 1.0f;
+    float rifleTopScale = 1.0f;
+    float rifleBottomScale = 1.0f;
+
+    bool operator==(const HudResources& o) const;
+    bool operator!=(const HudResources& o) const { return !(*this == o); }
+};
+
+// Retained-mode player HUD. Widgets are created once and only updated when the values they show change:
+// a new window size rebuilds the layout, a weapon swap re-lays the icons, an ammo change re-sets the
+// ammo strings. The static backdrops (bar container, bar backgrounds, weapon panels) are cached in two
+// small render textures that are only re-rendered on a layout change.
+class RetainedHud {
+public:
+    void draw(InstrumentedTarget& target, const sf::Vector2u& windowSize, const HudResources& resources, const HudValues& values);
+
+    // Force a full rebuild on the next draw
+    void invalidate() { layoutValid = false; }
+
+private:
+    // A static layer: drawables rendered once into a texture covering bounds
+    struct CachedLayer {
+        sf::RenderTexture texture;
+        sf::Sprite sprite;
+        sf::FloatRect bounds;
+        bool ready = false;
+    };
+
+    void rebuildLayout(const sf::Vector2u& windowSize);
+    void renderLayer(CachedLayer& layer, const sf::FloatRect& bounds, const sf::Drawable* const* drawables, size_t count);
+    void drawLayer(InstrumentedTarget& target, const CachedLayer& layer, const sf::Drawable* const* drawables, size_t count);
+    void updateIcons();
+    void updateAmmo(const HudValues& values);
+    void updateBars(const HudValues& values);
+
+    // Layout (window pixels), derived from the window size
+    sf::Vector2u layoutSize;
+    bool layoutValid = false;
+    sf::Vector2f barPos;     // health bar top-left; the stamina bar sits below it
+    float staminaY = 0.0f;
+    sf::FloatRect panelTop;  // equipped weapon panel
+    sf::FloatRect panelBottom;
+    float iconLineX = 0.0f;  // icons are centred between the panel's left edge and this line
+
+    // Static pieces, cached in the layers (drawn directly if a render texture cannot be created)
+    sf::VertexArray barContainer{ sf::Triangles, 6 };
+    sf::RectangleShape healthBg;
+    sf::RectangleShape staminaBg;
+    sf::RectangleShape panelTopShape;
+    sf::RectangleShape panelBottomShape;
+    CachedLayer barsLayer;
+    CachedLayer panelsLayer;
+    // White side outlines and brackets of the top panel (drawn over the icons, one draw)
+    sf::VertexArray panelFrame{ sf::Quads };
+
+    // Dynamic widgets
+    sf::RectangleShape healthFill;
+    sf::RectangleShape staminaFill;
+    sf::RectangleShape flashFill;
+    sf::Sprite topIcon;
+    sf::Sprite bottomIcon;
+    sf::Sprite keyIcon;
+    bool hasTopIcon = false;
+    bool hasBottomIcon = false;
+    bool hasKeyIcon = false;
+    sf::Text topAmmoText;
+    sf::Text topMagText;
+    sf::Text bottomAmmoText;
+    sf::Text bottomMagText;
+
+    // Last values the widgets were built from
+    HudResources shownResources;
+    HudValues shown;
+    bool iconsValid = false;
+    bool ammoValid = false;
+    bool barsValid = false;
+};
@@ -0,0 +1,95 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <vector>
+
+// Signed-distance-field version of an sf::Font: the glyphs are rasterized once at a base size, turned
+// into distance fields and packed into one atlas, which SdfText draws at any size through a shader
+// (no new glyph page per character size, so no first-use hitch for large titles).
+class SdfFont {
+public:
+    struct Glyph {
+        float advance = 0.0f;
+        sf::FloatRect bounds;  // at the base size, relative to the pen on the baseline
+        sf::FloatRect quad;    // bounds grown by the field spread
+        sf::FloatRect texRect; // in atlas pixels
+    };
+
+    SdfFont() = default;
+    SdfFont(const SdfFont&) = delete;
+    SdfFont& operator=(const SdfFont&) = delete;
+
+    // Build the atlas for the printable ASCII range. The source font must outlive this object (it is
+    // used for kerning and as the fallback when shaders are unavailable).
+    bool loadFromFont(const sf::Font& font, bool bold = false, unsigned baseSize = 64, unsigned spread = 8);
+    // Ready to draw with the SDF path
+    bool isReady() const { return ready; }
+
+    const Glyph* getGlyph(sf::Uint32 codePoint) const;
+    float getKerning(sf::Uint32 first, sf::Uint32 second) const;
+    float getLineSpacing() const;
+    unsigned getBaseSize() const { return baseSize; }
+    unsigned getSpread() const { return spread; }
+    bool isBold() const { return bold; }
+    const sf::Font* getSourceFont() const { return source; }
+    const sf::Texture& getTexture() const { return atlas; }
+    sf::Shader& getShader() const { return shader; }
+
+private:
+    const sf::Font* source = nullptr;
+    bool bold = false;
+    unsigned baseSize = 64;
+    unsigned spread = 8;
+    bool ready = false;
+    std::unordered_map<sf::Uint32, Glyph> glyphs;
+    sf::Texture atlas;
+    mutable sf::Shader shader; // uniforms are set per draw
+};
+
+// Text drawn from an SdfFont; a small subset of sf::Text (fill, outline, size). Geometry is rebuilt
+// only when the string, size or font changes. Falls back to a plain sf::Text when the font has no SDF
+// atlas (shaders unavailable).
+class SdfText : public sf::Drawable, public sf::Transformable {
+public:
+    void setFont(const SdfFont& font);
+    void setString(const sf::String& string);
+    void setCharacterSize(unsigned size);
+    void setFillColor(const sf::Color& color);
+    void setOutlineColor(const sf::Color& color) { outlineColor = color; }
+    void setOutlineThickness(float thickness);
+
+    sf::FloatRect getLocalBounds() const;
+    sf::FloatRect getGlobalBounds() const { return getTransform().transformRect(getLocalBounds()); }
+
+    // What draw() submits, for draw-call instrumentation (the sf::Text fallback is estimated like sf::Text)
+    std::size_t getVertexCount() const;
+    const sf::Texture* getTexture() const;
+
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void ensureGeometry() const;
+    const sf::Text& fallbackText() const;
+
+    const SdfFont* font = nullptr;
+    sf::String string;
+    unsigned characterSize = 30;
+    sf::Color fillColor = sf::Color::White;
+    sf::Color outlineColor = sf::Color::Black;
+    float outlineThickness = 0.0f;
+
+    mutable sf::VertexArray vertices{ sf::Triangles };
+    mutable sf::FloatRect bounds;
+    mutable bool geometryDirty = true;
+    mutable sf::Text fallback;
+};
+
+// Glyph cache prewarm: rasterize the given characters into the font's pages for every style the UI
+// uses, so the first frame that shows a menu doesn't have to. Each style is a separate glyph set in
+// SFML (size, bold and outline thickness are all part of the key).
+struct GlyphStyle {
+    unsigned size;
+    bool bold;
+    float outline;
+};
+void prewarmGlyphs(const sf::Font& font, const std::vector<GlyphStyle>& styles,
+                   const sf::String& characters = sf::String());
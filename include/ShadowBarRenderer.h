@@ -0,0 +1,29 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class RenderQueue;
+
+// Collects every blob shadow as a textured quad and every health bar as colored quads, then submits each
+// set to the render queue as one item (one draw call each). The vertex storage is kept between frames, so
+// it stops allocating once warmed up.
+class ShadowBarRenderer {
+public:
+    // All shadows share this texture; without one addShadow() is a no-op
+    void setShadowTexture(const sf::Texture* tex) { shadowTexture = tex; }
+
+    // Shadow centred on a world position, at the texture's size times scale
+    void addShadow(const sf::Vector2f& center, float scale, const sf::Color& color);
+    // Background bar with a foreground bar of fill (0..1) times its width, both centred on center
+    void addBar(const sf::Vector2f& center, const sf::Vector2f& size, float fill, const sf::Color& background, const sf::Color& foreground);
+
+    // Submit and empty both sets (RenderLayer::Shadows under the bodies, RenderLayer::HealthBars over them)
+    void submit(RenderQueue& queue);
+
+private:
+    const sf::Texture* shadowTexture = nullptr;
+    std::vector<sf::Vertex> shadowVertices;
+    std::vector<sf::Vertex> barVertices;
+
+    static void appendQuad(std::vector<sf::Vertex>& out, const sf::FloatRect& rect, const sf::Color& color);
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Runtime side of tools/AtlasPacker: loads the packed pages plus the metadata file and resolves
+// frames by name. Loaders try the atlas first and fall back to the loose sheets when a name is missing.
+class TextureAtlas {
+public:
+    struct Frame {
+        const sf::Texture* texture = nullptr;
+        sf::IntRect rect;
+    };
+
+    // Atlas produced by the build (assets/atlas/atlas.txt), loaded on first use and shared by all loaders
+    static const TextureAtlas& shared();
+
+    bool loadFromFile(const std::string& metadataPath);
+    bool isLoaded() const { return !pages.empty(); }
+
+    const Frame* find(const std::string& name) const;
+    // Collect <name>_0, <name>_1, ... in order. Fails if the first frame is missing; the packer keeps a
+    // sequence on one page, so every rect refers to outTexture.
+    bool getSequence(const std::string& name, const sf::Texture*& outTexture, std::vector<sf::IntRect>& outRects) const;
+
+private:
+    std::vector<std::unique_ptr<sf::Texture>> pages;
+    std::unordered_map<std::string, Frame> frames;
+};
@@ -0,0 +1,64 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <vector>
+
+// Previous and current positions of every interpolated renderable (player, zombies, bullets), stored as
+// interleaved x,y floats in contiguous arrays. Game calls beginStep() at the start of each fixed step
+// (current becomes previous for everyone at once), entities write their new position with setCurrent(),
+// and interpolate() computes all render positions for the frame in one pass over the arrays.
+class TransformBuffer {
+public:
+    static const uint32_t kInvalid = 0xFFFFFFFFu;
+
+    static TransformBuffer& instance();
+
+    // A slot starts with previous == current == position
+    uint32_t acquire(const sf::Vector2f& position);
+    void release(uint32_t slot);
+
+    void beginStep();
+    void setCurrent(uint32_t slot, const sf::Vector2f& position);
+    // Move without interpolating from the old position (spawns, respawns, resets)
+    void teleport(uint32_t slot, const sf::Vector2f& position);
+
+    // Render positions at alpha between the previous and the current step
+    void interpolate(float alpha);
+    float getAlpha() const { return alpha; }
+
+    sf::Vector2f getCurrent(uint32_t slot) const { return sf::Vector2f(curr[2 * slot], curr[2 * slot + 1]); }
+    sf::Vector2f getInterpolated(uint32_t slot) const { return sf::Vector2f(interpolated[2 * slot], interpolated[2 * slot + 1]); }
+    // Movement over the last step (current minus previous)
+    sf::Vector2f getMotion(uint32_t slot) const {
+        return sf::Vector2f(curr[2 * slot] - prev[2 * slot], curr[2 * slot + 1] - prev[2 * slot + 1]);
+    }
+
+    size_t getLiveCount() const { return curr.size() / 2 - freeSlots.size(); }
+
+private:
+    std::vector<float> prev;
+    std::vector<float> curr;
+    std::vector<float> interpolated;
+    std::vector<uint32_t> freeSlots;
+    float alpha = 1.0f;
+};
+
+// Owning handle to a TransformBuffer slot, held by each interpolated entity (move-only)
+class TransformSlot {
+public:
+    explicit TransformSlot(const sf::Vector2f& position = sf::Vector2f())
+        : slot(TransformBuffer::instance().acquire(position)) {}
+    ~TransformSlot() { if (slot != TransformBuffer::kInvalid) TransformBuffer::instance().release(slot); }
+    TransformSlot(const TransformSlot&) = delete;
+    TransformSlot& operator=(const TransformSlot&) = delete;
+    TransformSlot(TransformSlot&& other) noexcept : slot(other.slot) { other.slot = TransformBuffer::kInvalid; }
+
+    void setCurrent(const sf::Vector2f& position) { TransformBuffer::instance().setCurrent(slot, position); }
+    void teleport(const sf::Vector2f& position) { TransformBuffer::instance().teleport(slot, position); }
+    sf::Vector2f getCurrent() const { return TransformBuffer::instance().getCurrent(slot); }
+    sf::Vector2f getInterpolated() const { return TransformBuffer::instance().getInterpolated(slot); }
+    sf::Vector2f getMotion() const { return TransformBuffer::instance().getMotion(slot); }
+
+private:
+    uint32_t slot;
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+
+// Camera visibility test shared by the world-space draw paths. Game sets it up once per frame from
+// gameView; each path asks it before doing any draw work, and the per-category counts feed the perf overlay.
+class ViewCuller {
+public:
+    enum class Category { Zombies, Bullets, Explosions, Guts, Count };
+
+    // Visible rect = view rect grown by padding on every side (sprite extents, shadows, bars)
+    void begin(const sf::View& view, float padding);
+
+    // Test world bounds and count the result under the category
+    bool accept(Category category, const sf::FloatRect& bounds);
+    // Same for things tracked by their centre
+    bool accept(Category category, const sf::Vector2f& center, float radius);
+    // Visible rect for DebugDraw (accepted bounds are reported by accept() itself)
+    void reportDebugShapes() const;
+
+    const sf::FloatRect& getRect() const { return rect; }
+    int getDrawn(Category category) const { return drawn[static_cast<size_t>(category)]; }
+    int getCulled(Category category) const { return culled[static_cast<size_t>(category)]; }
+    static const char* getName(Category category);
+
+private:
+    static constexpr size_t kCategoryCount = static_cast<size_t>(Category::Count);
+    sf::FloatRect rect;
+    std::array<int, kCategoryCount> drawn{};
+    std::array<int, kCategoryCount> culled{};
+};
@@ -0,0 +1,218 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include "BaseZombie.h"
+#include "NoiseField.h"
+#include "CorpseSystem.h"
+
+// Zombie behaviour expressed as data. Each ZombieType gets a ZombieTraits specialisation holding its
+// tuning, its attack timeline (which animation frames stop, lunge and deal damage) and a constexpr
+// state transition table. ZombieBehavior<T> is the single update routine, instantiated per type, so a
+// batch of same-type zombies is stepped with no virtual calls and no per-instance branching on type.
+// Adding a zombie type means adding a traits specialisation (plus its art), not a new update path.
+
+// Things that can move a zombie between states
+enum class ZombieEvent {
+    PlayerInRange,   // player within attack range and the attack cooldown has elapsed
+    AttackFinished   // the (non-looping) attack animation reached its last frame
+};
+
+struct ZombieTransition {
+    ZombieState from;
+    ZombieEvent event;
+    ZombieState to;
+};
+
+// 0-based animation frame indices within the attack clip
+struct AttackTimeline {
+    int fastWindupFrames;  // frames before this index play at half frame time
+    int preLungeFrame;     // movement stops on this frame
+    int lungeStartFrame;   // lunge towards the last seen player position begins
+    int lungeStopFrame;    // lunge ends (also ends after lungeDuration)
+    int damageFirstFrame;  // first frame where the attack can damage the player
+    int damageLastFrame;   // last frame where the attack can damage the player
+};
+
+// Primary template is intentionally undefined: using a type without traits fails to compile
+template<ZombieType T> struct ZombieTraits;
+
+template<> struct ZombieTraits<ZombieType::WALKER> {
+    static constexpr float attackRange = 100.0f;
+    static constexpr float attackCooldown = 2.0f;
+    static constexpr float attackFrameTime = 0.1f;
+    static constexpr bool lunges = true;
+    static constexpr float lungeSpeed = 120.0f;
+    static constexpr float lungeDuration = 0.09f;
+    static constexpr AttackTimeline attack = { 4, 2, 4, 6, 5, 6 };
+    static constexpr CorpseArchetype corpse = { 0.45f, 70.0f, 0.92f, 120 };
+    static constexpr std::array<ZombieTransition, 2> transitions = {{
+        { ZombieState::WALK,   ZombieEvent::PlayerInRange,  ZombieState::ATTACK },
+        { ZombieState::ATTACK, ZombieEvent::AttackFinished, ZombieState::WALK },
+    }};
+};
+
+// Table lookup; events without a matching row leave the state unchanged
+template<ZombieType T>
+constexpr ZombieState nextState(ZombieState from, ZombieEvent event) {
+    for (const ZombieTransition& t : ZombieTraits<T>::transitions) {
+        if (t.from == from && t.event == event) return t.to;
+    }
+    return from;
+}
+
+template<ZombieType T>
+constexpr bool isValidTimeline() {
+    constexpr AttackTimeline a = ZombieTraits<T>::attack;
+    return a.preLungeFrame <= a.lungeStartFrame && a.lungeStartFrame <= a.lungeStopFrame
+        && a.damageFirstFrame <= a.damageLastFrame;
+}
+
+static_assert(nextState<ZombieType::WALKER>(ZombieState::WALK, ZombieEvent::PlayerInRange) == ZombieState::ATTACK,
+              "walker must attack when the player is in range");
+static_assert(nextState<ZombieType::WALKER>(ZombieState::ATTACK, ZombieEvent::AttackFinished) == ZombieState::WALK,
+              "walker must resume walking after an attack");
+static_assert(isValidTimeline<ZombieType::WALKER>(), "walker attack timeline frames are out of order");
+
+template<ZombieType T>
+struct ZombieBehavior {
+    using Traits = ZombieTraits<T>;
+
+    // Step every zombie in the list. All entries must be of type T (LevelManager keeps one pool per type).
+    // noise may be null, in which case zombies that can't see the player only use their memory.
+    static void updateBatch(const std::vector<BaseZombie*>& zombies, float deltaTime, sf::Vector2f playerPosition,
+                            const NoiseField* noise = nullptr) {
+        const Vec2 playerPos(playerPosition.x, playerPosition.y);
+        for (BaseZombie* z : zombies) step(*z, deltaTime, playerPos, noise);
+    }
+
+    static void step(BaseZombie& z, float deltaTime, const Vec2& playerPos, const NoiseField* noise) {
+        // (the previous position was stored for every entity by TransformBuffer::beginStep)
+        if (z.dead) return;
+
+        // Only zombies that can see the player learn its exact position; the rest head for the
+        // loudest nearby noise, or else the last place they knew the player to be
+        if (z.playerInSight) z.lastSeenPlayerPos = playerPos;
+        Vec2 direction = z.lastSeenPlayerPos - z.body.position;
+        float distance = direction.length();
+        if (!z.playerInSight && noise) {
+            sf::Vector2f here(z.body.position.x, z.body.position.y);
+            sf::Vector2f g = noise->gradient(here);
+            if (noise->sample(here) > noise->getAudibleThreshold() && (g.x != 0.f || g.y != 0.f)) {
+                direction = Vec2(g.x, g.y);
+                // the source is somewhere up the gradient; treat it as far away so the zombie keeps walking
+                distance = std::numeric_limits<float>::max();
+                // forget the stale position so the zombie stays near the noise once it fades
+                z.lastSeenPlayerPos = z.body.position;
+            } else if (distance <= 5.0f) {
+                // reached the remembered spot with nothing to hear: pick up the player's trail again
+                z.lastSeenPlayerPos = playerPos;
+            }
+        }
+
+        z.timeSinceLastAttack += deltaTime;
+
+        if (z.playerInSight && distance <= Traits::attackRange && z.timeSinceLastAttack >= Traits::attackCooldown) {
+            fire(z, ZombieEvent::PlayerInRange);
+            z.timeSinceLastAttack = 0.0f;
+        }
+        else if (!z.attacking) {
+            if (distance > 5.0f) {
+                z.setState(ZombieState::WALK);
+                if (distance > 0) direction.normalize();
+                if (!z.lunging) z.body.velocity = direction * z.speed;
+            }
+            else {
+                z.body.velocity = Vec2(0, 0);
+            }
+        }
+        else {
+            z.body.velocity = Vec2(0, 0);
+        }
+
+        // Advance the animation before the attack timeline so frame-driven events (lunge start) apply this step
+        z.animator.setLOD((z.attacking && z.animLOD == Animator::LOD::Half) ? Animator::LOD::Full : z.animLOD);
+        z.animator.update(deltaTime);
+        stepAttack(z, deltaTime);
+
+        z.transform.setCurrent(sf::Vector2f(z.body.position.x, z.body.position.y));
+        // No turning while lunging or while the lunge has locked facing
+        if (distance > 1.0f && z.canRotateOverride && !z.lunging) {
+            float angle = std::atan2(direction.y, direction.x) * 180 / 3.14159265f;
+            z.sprite.setRotation(angle + z.rotationOffset);
+        }
+    }
+
+private:
+    static void fire(BaseZombie& z, ZombieEvent event) {
+        ZombieState next = nextState<T>(z.currentState, event);
+        if (next == z.currentState) return;
+        if (next == ZombieState::ATTACK) {
+            z.attack();
+        } else if (next == ZombieState::WALK) {
+            z.attacking = false;
+            z.m_hasDealtDamageInAttack = false;
+            z.setState(ZombieState::WALK);
+        }
+    }
+
+    static void stepAttack(BaseZombie& z, float deltaTime) {
+        if (z.currentState == ZombieState::ATTACK && !z.animator.isPlaying()) fire(z, ZombieEvent::AttackFinished);
+        z.isInDamageWindow = false;
+
+        if (z.currentState == ZombieState::ATTACK) {
+            constexpr AttackTimeline tl = Traits::attack;
+            const int frame = static_cast<int>(z.animator.getCurrentFrameIndex());
+
+            if (!z.preLungeHandled && frame >= tl.preLungeFrame) {
+                z.preLungeHandled = true;
+                z.body.velocity = Vec2(0, 0);
+            }
+            z.animator.setFrameTime(frame < tl.fastWindupFrames ? z.attackFrameTime * 0.5f : z.attackFrameTime);
+
+            if constexpr (Traits::lunges) {
+                if (!z.lunging && frame >= tl.lungeStartFrame) startLunge(z);
+            }
+
+            // a new attack starts with its damage unspent
+            if (frame == 0) z.m_hasDealtDamageInAttack = false;
+            z.isInDamageWindow = (frame >= tl.damageFirstFrame && frame <= tl.damageLastFrame);
+        }
+
+        if constexpr (Traits::lunges) {
+            if (z.lunging) {
+                z.lungeTimer += deltaTime;
+                z.body.velocity = z.lungeDir * Traits::lungeSpeed;
+                int frame = static_cast<int>(z.animator.getCurrentFrameIndex());
+                if (frame >= Traits::attack.lungeStopFrame || z.lungeTimer >= Traits::lungeDuration) {
+                    z.lunging = false;
+                    z.lungeTimer = 0.0f;
+                    z.body.velocity = Vec2(0, 0);
+                    z.preLungeHandled = false;
+                    z.canRotateOverride = true;
+                }
+            }
+        }
+    }
+
+    static void startLunge(BaseZombie& z) {
+        // snapshot player's position so the lunge continues even if the player moves
+        z.lungeTargetPos = z.lastSeenPlayerPos;
+        Vec2 dir = z.lungeTargetPos - z.body.position;
+        float len = dir.length();
+        if (len > 0.0001f) {
+            z.lungeDir = Vec2(dir.x / len, dir.y / len);
+        } else {
+            float rad = (z.sprite.getRotation() - z.rotationOffset) * 3.14159265f / 180.f;
+            z.lungeDir = Vec2(std::cos(rad), std::sin(rad));
+        }
+
+        z.lunging = true;
+        z.lungeTimer = 0.0f;
+        // lock facing to the lunge direction
+        float ang = std::atan2(z.lungeDir.y, z.lungeDir.x) * 180.0f / 3.14159265f;
+        z.sprite.setRotation(ang + z.rotationOffset);
+        z.canRotateOverride = false;
+    }
+};
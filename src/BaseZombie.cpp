@@ -4,6 +4,8 @@
 #include <algorithm>
 #include "ExplosionProvider.h"
 #include "Guts.h"
+#include "RenderQueue.h"
+#include "ShadowBarRenderer.h"
 
 BaseZombie::BaseZombie(float x, float y, float health, float attackDamage, float speed, float attackRange, float attackCooldown)
     : Entity(EntityType::Enemy, Vec2(x, y), Vec2(50.f, 50.f), false, 1.0f, true),
@@ -26,78 +28,16 @@ BaseZombie::BaseZombie(float x, float y, float health, float attackDamage, float
     m_hasDealtDamageInAttack(false) {
     // attach animator to sprite
     animator.setSprite(&sprite);
+    transform.teleport(sf::Vector2f(x, y));
 }
 
-void BaseZombie::update(float deltaTime, sf::Vector2f playerPosition) {
-    // store previous pos for interpolation
-    prevPos = currPos;
-
-    if (dead) {
-        updateAnimation(deltaTime);
-        return;
-    }
-
-    Vec2 playerPos(playerPosition.x, playerPosition.y);
-    Vec2 direction = playerPos - body.position;
-    float distance = direction.length();
-
-    // record latest player pos for derived classes
-    lastSeenPlayerPos = playerPos;
-
-    timeSinceLastAttack += deltaTime;
-
-    if (distance <= attackRange && timeSinceLastAttack >= attackCooldown) {
-        attack();
-        timeSinceLastAttack = 0.0f;
-        // Do not immediately zero velocity here; derived classes may want to continue
-        // moving until a specific attack frame (pre-lunge).
-    }
-    else if (!attacking) {
-        if (distance > 5.0f) {
-            setState(ZombieState::WALK);
-
-            if (distance > 0) direction.normalize();
-            if (!isMovementLocked()) body.velocity = direction * speed;
-        }
-        else {
-            body.velocity = Vec2(0, 0);
-        }
-    }
-    else {
-        body.velocity = Vec2(0, 0);
-    }
-
-    // Allow animator and derived classes to update state (e.g., start a lunge) before applying rotation
-    animator.update(deltaTime);
-    updateAnimation(deltaTime); // keep any logic (like attack timing)
-
-    // Store current physics position (do not directly set sprite position here)
-    currPos = sf::Vector2f(body.position.x, body.position.y);
-    // Only rotate if allowed and movement isn't locked by derived behavior (e.g., lunging)
-    if (distance > 1.0f && canRotate() && !isMovementLocked()) {
-        float angle = std::atan2(direction.y, direction.x) * 180 / 3.14159265f;
-        sprite.setRotation(angle + rotationOffset);
-    }
-}
-
-void BaseZombie::draw(sf::RenderWindow& window) const {
-    // interpolate position
-    sf::Vector2f interp = prevPos + (currPos - prevPos) * renderAlpha;
+void BaseZombie::draw(RenderQueue& queue) const {
+    sf::Vector2f interp = transform.getInterpolated();
     sf::Sprite temp = sprite;
-
-    // draw shadow if available
-    if (shadowTexture) {
-        sf::Sprite sh;
-        sh.setTexture(*shadowTexture);
-        sh.setOrigin(shadowTexture->getSize().x * 0.5f, shadowTexture->getSize().y * 0.5f);
-        sh.setPosition(interp.x, interp.y + 10.0f);
-        sh.setScale(1.0f, 1.0f);
-        sh.setColor(sf::Color(0,0,0,140));
-        window.draw(sh);
-    }
     temp.setPosition(interp);
+    queue.setMotion(transform.getMotion());
     // Draw the sprite normally
-    window.draw(temp);
+    queue.submitSprite(RenderLayer::Zombies, temp);
 
     // Additive white overlay to simulate brightening:
     // - subtle overlay while attacking
@@ -107,13 +47,19 @@ void BaseZombie::draw(sf::RenderWindow& window) const {
         if (isInDamageWindow) {
             // stronger white flash when damage can be dealt
             overlay.setColor(sf::Color(255,255,255,220));
-            window.draw(overlay, sf::RenderStates(sf::BlendAdd));
+            queue.submitSprite(RenderLayer::ZombieFlashes, overlay, sf::BlendAdd);
         } else {
             // more subtle white glow during attack wind-up
             overlay.setColor(sf::Color(255,255,255,60));
-            window.draw(overlay, sf::RenderStates(sf::BlendAdd));
+            queue.submitSprite(RenderLayer::ZombieFlashes, overlay, sf::BlendAdd);
         }
     }
+    queue.setMotion(sf::Vector2f());
+}
+
+void BaseZombie::drawShadowAndHealthBar(ShadowBarRenderer& overlays) const {
+    sf::Vector2f interp = transform.getInterpolated();
+    if (shadowTexture) overlays.addShadow(sf::Vector2f(interp.x, interp.y + 10.0f), 1.0f, sf::Color(0,0,0,140));
 
     if (!dead) {
         // Narrower health bar, darker background, positioned closer to the zombie (uses interpolated position)
@@ -123,36 +69,23 @@ void BaseZombie::draw(sf::RenderWindow& window) const {
 
         float healthPercent = 1.0f;
         if (maxHealth > 0.0f) healthPercent = health / maxHealth;
-        if (healthPercent < 0.0f) healthPercent = 0.0f;
-        if (healthPercent > 1.0f) healthPercent = 1.0f;
-
-        // Background (darker)
-        sf::RectangleShape healthBarBackground;
-        healthBarBackground.setSize(sf::Vector2f(barWidth, barHeight));
-        healthBarBackground.setFillColor(sf::Color(40, 40, 40, 220));
-        healthBarBackground.setOrigin(barWidth * 0.5f, barHeight * 0.5f);
-        healthBarBackground.setPosition(interp.x, interp.y - verticalOffset);
-
-        // Foreground bar (centered within background)
-        sf::RectangleShape healthBar;
-        healthBar.setSize(sf::Vector2f(barWidth * healthPercent, barHeight));
-        healthBar.setFillColor(sf::Color(200, 30, 30, 220));
-        // center the foreground by setting origin to half of its current width
-        healthBar.setOrigin((barWidth * healthPercent) * 0.5f, barHeight * 0.5f);
-        healthBar.setPosition(interp.x, interp.y - verticalOffset);
-
-        window.draw(healthBarBackground);
-        window.draw(healthBar);
+        overlays.addBar(sf::Vector2f(interp.x, interp.y - verticalOffset), sf::Vector2f(barWidth, barHeight), healthPercent,
+                        sf::Color(40, 40, 40, 220), sf::Color(200, 30, 30, 220));
     }
 }
 
 sf::FloatRect BaseZombie::getBounds() const {
-    return sprite.getGlobalBounds();
+    // The member sprite keeps its construction position (draw() positions a copy), so move its
+    // bounds to where the zombie is drawn this frame
+    sf::FloatRect bounds = sprite.getGlobalBounds();
+    const sf::Vector2f offset = transform.getInterpolated() - sprite.getPosition();
+    bounds.left += offset.x;
+    bounds.top += offset.y;
+    return bounds;
 }
 
 void BaseZombie::attack() {
     if (attacking || dead) return;
-    std::cout << "Zombie is attacking!" << std::endl; // TEMP LOG
 
     attacking = true;
     currentAttackFrame = 0;
@@ -161,7 +94,7 @@ void BaseZombie::attack() {
 
     // switch animator to attack frames if available
     if (hasAttackSheet && !attackRects.empty()) {
-        animator.setFrames(&attackSheetTexture, attackRects, attackFrameTime, false);
+        animator.setFrames(attackSheetTexture, attackRects, attackFrameTime, false);
         animator.play(true);
     } else if (!attackTextures.empty()) {
         animator.setFrames(&attackTextures, attackFrameTime, false);
@@ -267,6 +200,12 @@ sf::FloatRect BaseZombie::getAttackHitbox() const {
 }
 
 void BaseZombie::getAttackOBB(sf::Vector2f& outCenter, sf::Vector2f& outHalfExtents, float& outRotationDeg) const {
+    sf::Vector2f forward;
+    getAttackBox(outCenter, outHalfExtents, forward);
+    outRotationDeg = std::atan2(forward.y, forward.x) * 180.0f / 3.14159265f;
+}
+
+void BaseZombie::getAttackBox(sf::Vector2f& outCenter, sf::Vector2f& outHalfExtents, sf::Vector2f& outForward) const {
     // Oriented attack box: width along forward direction, height perpendicular
     const float attackW = 40.0f; // narrower attack box for smaller zombies
     const float attackH = 25.0f;
@@ -286,7 +225,7 @@ void BaseZombie::getAttackOBB(sf::Vector2f& outCenter, sf::Vector2f& outHalfExte
 
     outCenter = sf::Vector2f(body.position.x + fx * forwardOffset, body.position.y + fy * forwardOffset);
     outHalfExtents = sf::Vector2f(attackW * 0.5f, attackH * 0.5f);
-    outRotationDeg = std::atan2(fy, fx) * 180.0f / 3.14159265f;
+    outForward = sf::Vector2f(fx, fy);
 }
 
 void BaseZombie::setState(ZombieState newState) {
@@ -314,7 +253,7 @@ void BaseZombie::setState(ZombieState newState) {
     // Switch animator frames depending on state (prefer sheets)
     if (currentState == ZombieState::ATTACK) {
         if (hasAttackSheet && !attackRects.empty()) {
-            animator.setFrames(&attackSheetTexture, attackRects, attackFrameTime, false);
+            animator.setFrames(attackSheetTexture, attackRects, attackFrameTime, false);
             animator.play(true);
         } else if (!attackTextures.empty()) {
             animator.setFrames(&attackTextures, attackFrameTime, false);
@@ -322,7 +261,7 @@ void BaseZombie::setState(ZombieState newState) {
         }
     } else if (currentState == ZombieState::WALK) {
         if (hasWalkSheet && !walkRects.empty()) {
-            animator.setFrames(&walkSheetTexture, walkRects, walkFrameTime, true);
+            animator.setFrames(walkSheetTexture, walkRects, walkFrameTime, true);
             animator.play(true);
         } else if (!walkTextures.empty()) {
             animator.setFrames(&walkTextures, walkFrameTime, true);
@@ -334,31 +273,13 @@ void BaseZombie::setState(ZombieState newState) {
     }
 }
 
-void BaseZombie::updateAnimation(float deltaTime) {
-    if (dead) return;
-
-    // Animator-driven playback: when animator stops and the state was attack, revert to walk
-    if (currentState == ZombieState::ATTACK) {
-        if (!animator.isPlaying()) {
-            // attack animation ended
-            attacking = false;
-            m_hasDealtDamageInAttack = false;
-            setState(ZombieState::WALK);
-        }
-    }
-
-    // Reset damage window flag after updating animation state
-    if (isInDamageWindow) {
-        isInDamageWindow = false;
-    }
-}
-
 bool BaseZombie::hasDealtDamageInAttack() const {
     return m_hasDealtDamageInAttack;
 }
 
 float BaseZombie::tryDealDamage() {
-    if (!m_hasDealtDamageInAttack) {
+    // isInDamageWindow is refreshed every step from the type's attack timeline
+    if (currentState == ZombieState::ATTACK && isInDamageWindow && !m_hasDealtDamageInAttack) {
         m_hasDealtDamageInAttack = true;
         return attackDamage;
     }
@@ -402,11 +323,22 @@ void BaseZombie::resetForSpawn(float x, float y, float healthVal, float damageVa
     // Reset state
     dead = false;
     attacking = false;
+    timeSinceLastAttack = 0.0f;
+    m_hasDealtDamageInAttack = false;
+    isInDamageWindow = false;
+    // A recycled zombie may have died mid-lunge
+    lunging = false;
+    lungeTimer = 0.0f;
+    preLungeHandled = false;
+    canRotateOverride = true;
     // Restore sprite visibility (kill() may have made it transparent)
     sprite.setColor(sf::Color(255,255,255,255));
+    // Spawned zombies start at full detail so the first walk frame is applied to the sprite
+    animLOD = Animator::LOD::Full;
+    animator.setLOD(animLOD);
     // Ensure animator is configured for walking and playing
     setState(ZombieState::WALK);
-    prevPos = currPos = sf::Vector2f(x, y);
+    transform.teleport(sf::Vector2f(x, y));
 }
 
 void BaseZombie::onPlayerDeath() {
@@ -1,6 +1,7 @@
 #include "Bullet.h"
 #include "BaseZombie.h"
 #include "ExplosionProvider.h"
+#include "RenderQueue.h"
 #include <iostream>
 #include <SFML/Audio.hpp>
 
@@ -97,9 +98,6 @@ Bullet::Bullet(Vec2 position, Vec2 velocity, float mass, int maxPenetrations, fl
     getBody().isCircle = true;
     body.isTrigger = true;
     body.velocity = velocity;
-    body.getCircleShape().setRadius(4.f);
-    body.getCircleShape().setOrigin(4.f, 4.f);
-    body.getCircleShape().setFillColor(sf::Color::Yellow);
 
     // Load texture for bullet
     sprite.setTexture(Bullet::bulletTexture);
@@ -109,7 +107,7 @@ Bullet::Bullet(Vec2 position, Vec2 velocity, float mass, int maxPenetrations, fl
     float angle = std::atan2(body.velocity.y, body.velocity.x) * 180.f / 3.14159f; // Get direction from velocity
     sprite.setRotation(angle + rotationOffset);
 
-    prevPos = currPos = sf::Vector2f(body.position.x, body.position.y);
+    transform.teleport(sf::Vector2f(body.position.x, body.position.y));
 
     // shorter default life to avoid accumulating many stray bullets
     lifeTimer = 0.0f;
@@ -117,12 +115,9 @@ Bullet::Bullet(Vec2 position, Vec2 velocity, float mass, int maxPenetrations, fl
 }
 
 void Bullet::update(float dt) {
-    // store previous position for interpolation
-    prevPos = currPos;
-
     body.update(dt); // Add physics updates if needed
 
-    currPos = sf::Vector2f(body.position.x, body.position.y);
+    transform.setCurrent(sf::Vector2f(body.position.x, body.position.y));
 
     // lifetime decay
     lifeTimer += dt;
@@ -131,10 +126,8 @@ void Bullet::update(float dt) {
     }
 }
 
-void Bullet::render(sf::RenderWindow& window) {
-    float alpha = renderAlpha;
-    // Interpolate position between prevPos and currPos
-    sf::Vector2f interp = prevPos + (currPos - prevPos) * alpha;
+void Bullet::updateSpriteTransform() {
+    sf::Vector2f interp = transform.getInterpolated();
 
     // Compute rotation from velocity
     float rad = std::atan2(body.velocity.y, body.velocity.x);
@@ -147,8 +140,13 @@ void Bullet::render(sf::RenderWindow& window) {
 
     sprite.setPosition(interp.x + rotatedOffset.x, interp.y + rotatedOffset.y);
     sprite.setRotation(deg + rotationOffset);
+}
 
-    window.draw(sprite);
+void Bullet::render(RenderQueue& queue) {
+    updateSpriteTransform();
+    queue.setMotion(transform.getMotion());
+    queue.submitSprite(RenderLayer::Bullets, sprite);
+    queue.setMotion(sf::Vector2f());
 }
 
 void Bullet::onCollision(Entity* other) {
@@ -0,0 +1,136 @@
+#include "ChunkedMap.h"
+#include "RenderQueue.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+void ChunkedMap::clear() {
+    chunks.clear();
+    chunkTextures.clear();
+    size = sf::Vector2u();
+    columns = rows = 0;
+    lastVisible = 0;
+}
+
+void ChunkedMap::beginGrid(const sf::Vector2u& mapSize, unsigned chunk) {
+    clear();
+    size = mapSize;
+    chunkSize = std::max(1u, chunk);
+    columns = (size.x + chunkSize - 1) / chunkSize;
+    rows = (size.y + chunkSize - 1) / chunkSize;
+    chunks.reserve(static_cast<size_t>(columns) * rows);
+}
+
+void ChunkedMap::upload(Chunk& chunk, const std::vector<sf::Vertex>& vertices) {
+    if (sf::VertexBuffer::isAvailable() && chunk.buffer.create(vertices.size()) && chunk.buffer.update(vertices.data())) return;
+    chunk.buffer = sf::VertexBuffer(sf::Quads, sf::VertexBuffer::Static);
+    for (const sf::Vertex& v : vertices) chunk.fallback.append(v);
+}
+
+void ChunkedMap::buildTiled(const sf::Texture& tile, const sf::Vector2u& mapSize, unsigned chunk) {
+    beginGrid(mapSize, chunk);
+    const sf::Vector2u ts = tile.getSize();
+    if (ts.x == 0 || ts.y == 0) return;
+
+    std::vector<sf::Vertex> vertices;
+    for (unsigned row = 0; row < rows; ++row) {
+        for (unsigned col = 0; col < columns; ++col) {
+            auto c = std::make_unique<Chunk>();
+            const unsigned x0 = col * chunkSize, y0 = row * chunkSize;
+            const unsigned x1 = std::min(size.x, x0 + chunkSize), y1 = std::min(size.y, y0 + chunkSize);
+            c->bounds = sf::FloatRect(static_cast<float>(x0), static_cast<float>(y0), static_cast<float>(x1 - x0), static_cast<float>(y1 - y0));
+            c->texture = &tile;
+
+            // One quad per tile cell; cells cut by the chunk or map edge use the matching part of the tile
+            vertices.clear();
+            for (unsigned y = y0; y < y1;) {
+                const unsigned ty = y % ts.y;
+                const unsigned h = std::min(ts.y - ty, y1 - y);
+                for (unsigned x = x0; x < x1;) {
+                    const unsigned tx = x % ts.x;
+                    const unsigned w = std::min(ts.x - tx, x1 - x);
+                    const float l = static_cast<float>(x), t = static_cast<float>(y);
+                    const float u = static_cast<float>(tx), v = static_cast<float>(ty);
+                    vertices.emplace_back(sf::Vector2f(l, t), sf::Vector2f(u, v));
+                    vertices.emplace_back(sf::Vector2f(l + w, t), sf::Vector2f(u + w, v));
+                    vertices.emplace_back(sf::Vector2f(l + w, t + h), sf::Vector2f(u + w, v + h));
+                    vertices.emplace_back(sf::Vector2f(l, t + h), sf::Vector2f(u, v + h));
+                    x += w;
+                }
+                y += h;
+            }
+            upload(*c, vertices);
+            chunks.push_back(std::move(c));
+        }
+    }
+}
+
+bool ChunkedMap::loadImage(const std::string& path, unsigned chunk) {
+    // sf::Image has no size limit, only textures do; each chunk gets its own texture
+    sf::Image image;
+    if (!image.loadFromFile(path)) {
+        std::cerr << "Error loading map image: " << path << std::endl;
+        clear();
+        return false;
+    }
+    const unsigned maxTexture = sf::Texture::getMaximumSize();
+    beginGrid(image.getSize(), std::min(chunk, maxTexture));
+
+    std::vector<sf::Vertex> vertices(4);
+    for (unsigned row = 0; row < rows; ++row) {
+        for (unsigned col = 0; col < columns; ++col) {
+            const int x0 = static_cast<int>(col * chunkSize), y0 = static_cast<int>(row * chunkSize);
+            const int w = std::min(static_cast<int>(chunkSize), static_cast<int>(size.x) - x0);
+            const int h = std::min(static_cast<int>(chunkSize), static_cast<int>(size.y) - y0);
+
+            auto texture = std::make_unique<sf::Texture>();
+            if (!texture->loadFromImage(image, sf::IntRect(x0, y0, w, h))) {
+                std::cerr << "Error creating map chunk texture (" << col << "," << row << ") from " << path << std::endl;
+                clear();
+                return false;
+            }
+
+            auto c = std::make_unique<Chunk>();
+            const float l = static_cast<float>(x0), t = static_cast<float>(y0);
+            const float fw = static_cast<float>(w), fh = static_cast<float>(h);
+            c->bounds = sf::FloatRect(l, t, fw, fh);
+            c->texture = texture.get();
+            vertices[0] = sf::Vertex(sf::Vector2f(l, t), sf::Vector2f(0.f, 0.f));
+            vertices[1] = sf::Vertex(sf::Vector2f(l + fw, t), sf::Vector2f(fw, 0.f));
+            vertices[2] = sf::Vertex(sf::Vector2f(l + fw, t + fh), sf::Vector2f(fw, fh));
+            vertices[3] = sf::Vertex(sf::Vector2f(l, t + fh), sf::Vector2f(0.f, fh));
+            upload(*c, vertices);
+
+            chunkTextures.push_back(std::move(texture));
+            chunks.push_back(std::move(c));
+        }
+    }
+    return true;
+}
+
+void ChunkedMap::submit(RenderQueue& queue, const sf::View& view) {
+    lastVisible = 0;
+    if (chunks.empty()) return;
+
+    // Chunk range under the view rectangle (grid lookup, no per-chunk test)
+    const sf::Vector2f c = view.getCenter();
+    const sf::Vector2f half = view.getSize() * 0.5f;
+    const float cs = static_cast<float>(chunkSize);
+    const int firstCol = std::max(0, static_cast<int>(std::floor((c.x - half.x) / cs)));
+    const int firstRow = std::max(0, static_cast<int>(std::floor((c.y - half.y) / cs)));
+    const int lastCol = std::min(static_cast<int>(columns) - 1, static_cast<int>(std::floor((c.x + half.x) / cs)));
+    const int lastRow = std::min(static_cast<int>(rows) - 1, static_cast<int>(std::floor((c.y + half.y) / cs)));
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int col = firstCol; col <= lastCol; ++col) {
+            const Chunk* chunk = chunks[static_cast<size_t>(row) * columns + col].get();
+            queue.submitCommand(RenderLayer::Map, [chunk](InstrumentedTarget& target) {
+                sf::RenderStates states;
+                states.texture = chunk->texture;
+                if (chunk->buffer.getVertexCount() > 0) target.draw(chunk->buffer, states);
+                else target.draw(chunk->fallback, states);
+            });
+            ++lastVisible;
+        }
+    }
+}
@@ -0,0 +1,142 @@
+#include "CombatSystem.h"
+#include "Player.h"
+#include "BaseZombie.h"
+#include "DebugDraw.h"
+#include <algorithm>
+#include <cmath>
+
+void CombatSystem::reportDebugShapes() const {
+    if (!DebugDraw::isEnabled()) return;
+    // Only the cell counts and box geometry are read; zombies may have been removed since resolve()
+    for (int cy = 0; cy < gridRows; ++cy) {
+        for (int cx = 0; cx < gridCols; ++cx) {
+            const uint32_t c = static_cast<uint32_t>(cy * gridCols + cx);
+            if (cellStart[c + 1] == cellStart[c]) continue;
+            DebugDraw::rect(sf::FloatRect(gridOrigin.x + cx * cellSize, gridOrigin.y + cy * cellSize, cellSize, cellSize), sf::Color(0, 160, 255, 90));
+        }
+    }
+    for (const AttackOBB& box : zombieAttackBoxes) DebugDraw::obb(box.center, box.halfExtents, box.axis, sf::Color(255, 60, 60));
+}
+
+int CombatSystem::cellX(float x) const {
+    return std::clamp(static_cast<int>((x - gridOrigin.x) / cellSize), 0, gridCols - 1);
+}
+
+int CombatSystem::cellY(float y) const {
+    return std::clamp(static_cast<int>((y - gridOrigin.y) / cellSize), 0, gridRows - 1);
+}
+
+void CombatSystem::buildIndex(const std::vector<BaseZombie*>& zombies) {
+    cellItems.clear();
+    gridCols = gridRows = 0;
+    if (zombies.empty()) return;
+
+    // Grid covers the live zombies' extent (clamped cell count; outliers share the edge cells)
+    sf::Vector2f mn = zombies[0]->getPosition(), mx = mn;
+    for (BaseZombie* z : zombies) {
+        sf::Vector2f p = z->getPosition();
+        mn.x = std::min(mn.x, p.x); mn.y = std::min(mn.y, p.y);
+        mx.x = std::max(mx.x, p.x); mx.y = std::max(mx.y, p.y);
+    }
+    gridOrigin = mn;
+    gridCols = std::clamp(static_cast<int>((mx.x - mn.x) / cellSize) + 1, 1, maxCellsPerAxis);
+    gridRows = std::clamp(static_cast<int>((mx.y - mn.y) / cellSize) + 1, 1, maxCellsPerAxis);
+
+    const size_t cellCount = static_cast<size_t>(gridCols) * gridRows;
+    cellStart.assign(cellCount + 1, 0);
+    itemCell.resize(zombies.size());
+    for (size_t i = 0; i < zombies.size(); ++i) {
+        sf::Vector2f p = zombies[i]->getPosition();
+        uint32_t c = static_cast<uint32_t>(cellY(p.y) * gridCols + cellX(p.x));
+        itemCell[i] = c;
+        cellStart[c + 1]++;
+    }
+    for (size_t c = 0; c < cellCount; ++c) cellStart[c + 1] += cellStart[c];
+
+    cellItems.resize(zombies.size());
+    cellCursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (size_t i = 0; i < zombies.size(); ++i) cellItems[cellCursor[itemCell[i]]++] = zombies[i];
+}
+
+template<typename Fn>
+void CombatSystem::query(const sf::FloatRect& area, Fn&& fn) {
+    if (gridCols == 0) return;
+    const int x0 = cellX(area.left - queryPadding);
+    const int x1 = cellX(area.left + area.width + queryPadding);
+    const int y0 = cellY(area.top - queryPadding);
+    const int y1 = cellY(area.top + area.height + queryPadding);
+    for (int cy = y0; cy <= y1; ++cy) {
+        for (int cx = x0; cx <= x1; ++cx) {
+            const uint32_t c = static_cast<uint32_t>(cy * gridCols + cx);
+            for (uint32_t i = cellStart[c]; i < cellStart[c + 1]; ++i) fn(*cellItems[i]);
+        }
+    }
+}
+
+void CombatSystem::damageZombie(BaseZombie& z, float amount) {
+    if (z.isDead()) return;
+    z.takeDamage(amount);
+    if (z.isDead() && onZombieKilled) onZombieKilled(z);
+}
+
+void CombatSystem::resolve(Player& player, const std::vector<BaseZombie*>& zombies) {
+    lastCandidateTests = 0;
+    buildIndex(zombies);
+
+    // Player melee: the swing stays active for several steps, but each zombie takes its damage once
+    const bool playerAttacking = player.isAttacking();
+    if (playerAttacking && !playerWasAttacking) swingHits.clear();
+    playerWasAttacking = playerAttacking;
+    if (playerAttacking) {
+        const sf::FloatRect attackBox = player.getAttackHitbox();
+        const float damage = player.getAttackDamage();
+        query(attackBox, [&](BaseZombie& z) {
+            ++lastCandidateTests;
+            if (z.isDead() || !attackBox.intersects(z.getHitbox())) return;
+            if (std::find(swingHits.begin(), swingHits.end(), &z) != swingHits.end()) return;
+            swingHits.push_back(&z);
+            damageZombie(z, damage);
+        });
+    }
+
+    resolveZombieBites(player, zombies);
+}
+
+void CombatSystem::resolveZombieBites(Player& player, const std::vector<BaseZombie*>& zombies) {
+    // Capture oriented attack boxes once per step, only for zombies that are attacking
+    zombieAttackBoxes.clear();
+    for (BaseZombie* zb : zombies) {
+        if (!zb->isAttacking()) continue;
+        AttackOBB box;
+        zb->getAttackBox(box.center, box.halfExtents, box.axis);
+        box.boundingRadius = std::sqrt(box.halfExtents.x * box.halfExtents.x + box.halfExtents.y * box.halfExtents.y);
+        box.owner = zb;
+        zombieAttackBoxes.push_back(box);
+    }
+
+    // Test them all against the player's hitbox; bounding circles reject distant boxes before the SAT test
+    const sf::FloatRect playerHitbox = player.getHitbox();
+    const sf::Vector2f playerCenter(playerHitbox.left + playerHitbox.width * 0.5f, playerHitbox.top + playerHitbox.height * 0.5f);
+    const float playerRadius = 0.5f * std::sqrt(playerHitbox.width * playerHitbox.width + playerHitbox.height * playerHitbox.height);
+    for (const AttackOBB& box : zombieAttackBoxes) {
+        float dx = box.center.x - playerCenter.x;
+        float dy = box.center.y - playerCenter.y;
+        float reach = box.boundingRadius + playerRadius;
+        if (dx * dx + dy * dy > reach * reach) continue;
+        if (!intersects(box, playerHitbox)) continue;
+
+        BaseZombie* zb = box.owner;
+        float damageToApply = zb->tryDealDamage();
+        if (damageToApply <= 0) continue;
+        player.takeDamage(damageToApply);
+
+        sf::Vector2f direction = player.getPosition() - zb->getPosition();
+        float magnitude = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        if (magnitude > 0) {
+            direction.x /= magnitude;
+            direction.y /= magnitude;
+            player.applyKnockback(direction, 50.0f);
+        }
+        if (onPlayerBitten) onPlayerBitten(*zb, damageToApply);
+    }
+}
@@ -0,0 +1,61 @@
+#include "CorpseSystem.h"
+#include "Explosion.h"
+#include "RenderQueue.h"
+#include <algorithm>
+
+// Ease-out so the topple starts fast and settles
+static float easeOutQuad(float t) {
+    return 1.0f - (1.0f - t) * (1.0f - t);
+}
+
+void CorpseSystem::spawn(const sf::Sprite& lastFrame, const sf::Vector2f& position, const CorpseArchetype& archetype) {
+    if (corpses.size() >= maxActive) {
+        stamp(corpses.front());
+        corpses.erase(corpses.begin());
+    }
+
+    Corpse c{ lastFrame, &archetype, lastFrame.getRotation(), lastFrame.getScale(), 1.0f, 0.0f };
+    // kill() hides the live sprite; the corpse starts fully visible
+    c.sprite.setColor(sf::Color::White);
+    c.sprite.setPosition(position);
+    // alternate topple direction so piles don't all lean the same way
+    c.toppleSign = (stampedCount + corpses.size()) % 2 == 0 ? 1.0f : -1.0f;
+    corpses.push_back(c);
+}
+
+void CorpseSystem::apply(Corpse& c, float t) const {
+    const CorpseArchetype& a = *c.archetype;
+    float e = easeOutQuad(std::clamp(t, 0.0f, 1.0f));
+    c.sprite.setRotation(c.baseRotation + c.toppleSign * a.toppleDeg * e);
+    float s = 1.0f + (a.endScale - 1.0f) * e;
+    c.sprite.setScale(c.baseScale.x * s, c.baseScale.y * s);
+    sf::Uint8 shade = static_cast<sf::Uint8>(255.0f + (static_cast<float>(a.endShade) - 255.0f) * e);
+    c.sprite.setColor(sf::Color(shade, shade, shade, 255));
+}
+
+void CorpseSystem::stamp(Corpse& c) {
+    apply(c, 1.0f);
+    Props::Explosion::stampToGround(c.sprite);
+    ++stampedCount;
+}
+
+void CorpseSystem::update(float deltaTime) {
+    // Order is irrelevant for drawing (corpses lie on the ground), so finished ones are swap-removed
+    for (size_t i = 0; i < corpses.size();) {
+        Corpse& c = corpses[i];
+        c.age += deltaTime;
+        float t = (c.archetype->duration > 0.0f) ? c.age / c.archetype->duration : 1.0f;
+        if (t >= 1.0f) {
+            stamp(c);
+            c = corpses.back();
+            corpses.pop_back();
+            continue;
+        }
+        apply(c, t);
+        ++i;
+    }
+}
+
+void CorpseSystem::draw(RenderQueue& queue) const {
+    for (const Corpse& c : corpses) queue.submitSprite(RenderLayer::Corpses, c.sprite);
+}
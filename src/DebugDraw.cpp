@@ -0,0 +1,71 @@
+#include "DebugDraw.h"
+
+#ifdef TDCOD_DEBUG_DRAW
+#include "RenderQueue.h"
+#include <cmath>
+
+bool DebugDraw::enabled = false;
+std::vector<sf::Vertex> DebugDraw::lines;
+size_t DebugDraw::lastLineCount = 0;
+
+void DebugDraw::setEnabled(bool on) {
+    enabled = on;
+    if (!on) {
+        lines.clear();
+        lastLineCount = 0;
+    }
+}
+
+void DebugDraw::line(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Color& color) {
+    if (!enabled) return;
+    lines.emplace_back(a, color);
+    lines.emplace_back(b, color);
+}
+
+void DebugDraw::rect(const sf::FloatRect& bounds, const sf::Color& color) {
+    if (!enabled) return;
+    const sf::Vector2f tl(bounds.left, bounds.top);
+    const sf::Vector2f tr(bounds.left + bounds.width, bounds.top);
+    const sf::Vector2f br(bounds.left + bounds.width, bounds.top + bounds.height);
+    const sf::Vector2f bl(bounds.left, bounds.top + bounds.height);
+    line(tl, tr, color);
+    line(tr, br, color);
+    line(br, bl, color);
+    line(bl, tl, color);
+}
+
+void DebugDraw::circle(const sf::Vector2f& center, float radius, const sf::Color& color, int segments) {
+    if (!enabled || segments < 3) return;
+    const float step = 2.0f * 3.14159265f / segments;
+    sf::Vector2f prev(center.x + radius, center.y);
+    for (int i = 1; i <= segments; ++i) {
+        sf::Vector2f p(center.x + std::cos(step * i) * radius, center.y + std::sin(step * i) * radius);
+        line(prev, p, color);
+        prev = p;
+    }
+}
+
+void DebugDraw::obb(const sf::Vector2f& center, const sf::Vector2f& halfExtents, const sf::Vector2f& axis, const sf::Color& color) {
+    if (!enabled) return;
+    const sf::Vector2f ux = axis * halfExtents.x;
+    const sf::Vector2f uy = sf::Vector2f(-axis.y, axis.x) * halfExtents.y;
+    const sf::Vector2f c0 = center - ux - uy, c1 = center + ux - uy, c2 = center + ux + uy, c3 = center - ux + uy;
+    line(c0, c1, color);
+    line(c1, c2, color);
+    line(c2, c3, color);
+    line(c3, c0, color);
+    // forward tick so the facing is visible
+    line(center, center + ux, color);
+}
+
+void DebugDraw::submit(RenderQueue& queue) {
+    lastLineCount = lines.size() / 2;
+    if (lines.empty()) return;
+    // The command owns a copy so it stays valid on the render thread; lines keeps its capacity
+    queue.submitCommand(RenderLayer::Debug, [frame = lines](InstrumentedTarget& target) {
+        target.draw(frame.data(), frame.size(), sf::Lines);
+    });
+    lines.clear();
+}
+
+#endif
@@ -0,0 +1,122 @@
+#include "EnemyProjectilePool.h"
+#include "PhysicsBody.h"
+#include "RenderQueue.h"
+#include <algorithm>
+#include <cmath>
+
+EnemyProjectilePool::EnemyProjectilePool() : vertices(sf::Quads) {
+    vertices.resize(kCapacity * 4);
+}
+
+bool EnemyProjectilePool::spawn(const Vec2& pos, const Vec2& vel, float r, float dmg, float lifetime) {
+    if (count >= kCapacity) return false;
+    size_t i = count++;
+    posX[i] = prevX[i] = pos.x;
+    posY[i] = prevY[i] = pos.y;
+    velX[i] = vel.x;
+    velY[i] = vel.y;
+    radius[i] = r;
+    damage[i] = dmg;
+    life[i] = lifetime;
+    return true;
+}
+
+int EnemyProjectilePool::spawnRing(const Vec2& center, int n, float speed, float r, float dmg, float lifetime, float angleOffsetRad) {
+    int spawned = 0;
+    for (int k = 0; k < n; ++k) {
+        float a = angleOffsetRad + (6.28318530f * k) / static_cast<float>(n);
+        if (!spawn(center, Vec2(std::cos(a) * speed, std::sin(a) * speed), r, dmg, lifetime)) break;
+        ++spawned;
+    }
+    return spawned;
+}
+
+void EnemyProjectilePool::removeAt(size_t i) {
+    size_t last = --count;
+    if (i == last) return;
+    posX[i] = posX[last]; posY[i] = posY[last];
+    prevX[i] = prevX[last]; prevY[i] = prevY[last];
+    velX[i] = velX[last]; velY[i] = velY[last];
+    radius[i] = radius[last];
+    damage[i] = damage[last];
+    life[i] = life[last];
+}
+
+float EnemyProjectilePool::update(float deltaTime, const PhysicsBody* playerBody, const std::vector<PhysicsBody*>& staticBodies, const sf::FloatRect& bounds) {
+    // Integrate all projectiles in one pass over contiguous arrays
+    for (size_t i = 0; i < count; ++i) {
+        prevX[i] = posX[i];
+        prevY[i] = posY[i];
+        posX[i] += velX[i] * deltaTime;
+        posY[i] += velY[i] * deltaTime;
+        life[i] -= deltaTime;
+    }
+
+    float px = 0.f, py = 0.f, pr = 0.f;
+    if (playerBody) {
+        px = playerBody->position.x;
+        py = playerBody->position.y;
+        pr = playerBody->size.x * 0.5f;
+    }
+
+    float damageToPlayer = 0.0f;
+    // Iterate backwards so swap-removal doesn't skip the moved-in projectile
+    for (size_t i = count; i-- > 0;) {
+        const float x = posX[i], y = posY[i], r = radius[i];
+        bool dead = life[i] <= 0.0f || !bounds.contains(x, y);
+
+        if (!dead && playerBody) {
+            float dx = x - px, dy = y - py, rs = r + pr;
+            if (dx*dx + dy*dy <= rs*rs) {
+                damageToPlayer += damage[i];
+                dead = true;
+            }
+        }
+
+        if (!dead) {
+            for (const PhysicsBody* s : staticBodies) {
+                if (s->isTrigger) continue;
+                if (s->isCircle) {
+                    float dx = x - s->position.x, dy = y - s->position.y, rs = r + s->size.x * 0.5f;
+                    if (dx*dx + dy*dy <= rs*rs) { dead = true; break; }
+                } else {
+                    float halfW = s->size.x * 0.5f, halfH = s->size.y * 0.5f;
+                    float cx = std::max(s->position.x - halfW, std::min(x, s->position.x + halfW));
+                    float cy = std::max(s->position.y - halfH, std::min(y, s->position.y + halfH));
+                    float dx = x - cx, dy = y - cy;
+                    if (dx*dx + dy*dy <= r*r) { dead = true; break; }
+                }
+            }
+        }
+
+        if (dead) removeAt(i);
+    }
+    return damageToPlayer;
+}
+
+void EnemyProjectilePool::draw(RenderQueue& queue, float renderAlpha) {
+    if (count == 0) return;
+    sf::Vector2f texSize(1.f, 1.f);
+    if (texture) texSize = sf::Vector2f(static_cast<float>(texture->getSize().x), static_cast<float>(texture->getSize().y));
+
+    for (size_t i = 0; i < count; ++i) {
+        float x = prevX[i] + (posX[i] - prevX[i]) * renderAlpha;
+        float y = prevY[i] + (posY[i] - prevY[i]) * renderAlpha;
+        float r = radius[i];
+        sf::Vertex* q = &vertices[i * 4];
+        q[0].position = sf::Vector2f(x - r, y - r);
+        q[1].position = sf::Vector2f(x + r, y - r);
+        q[2].position = sf::Vector2f(x + r, y + r);
+        q[3].position = sf::Vector2f(x - r, y + r);
+        q[0].texCoords = sf::Vector2f(0.f, 0.f);
+        q[1].texCoords = sf::Vector2f(texSize.x, 0.f);
+        q[2].texCoords = texSize;
+        q[3].texCoords = sf::Vector2f(0.f, texSize.y);
+        for (int k = 0; k < 4; ++k) q[k].color = color;
+
+        // One item per projectile so each carries its own motion; flush merges them back into one draw
+        queue.setMotion(sf::Vector2f(posX[i] - prevX[i], posY[i] - prevY[i]));
+        queue.submitQuads(RenderLayer::EnemyProjectiles, texture, sf::BlendAdd, q, 4);
+    }
+    queue.setMotion(sf::Vector2f());
+}
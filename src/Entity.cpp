@@ -9,8 +9,9 @@ Entity::Entity(EntityType type, Vec2 position, Vec2 size, bool isStatic, float m
 void Entity::update(float dt) {
 }
 
-void Entity::render(sf::RenderWindow& window) {
-    window.draw(body.getShape());
+void Entity::render(sf::RenderWindow& /*window*/) {
+    // No visual of its own; the collision shape shows up in debug draw
+    body.reportDebugShape();
 }
 
 void Entity::onCollision(Entity* other) {
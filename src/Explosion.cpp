@@ -1,8 +1,12 @@
 #define SFML_NO_DEPRECATED_WARNINGS
 #include "Explosion.h"
+#include "RenderQueue.h"
+#include "ViewCuller.h"
+#include <SFML/OpenGL.hpp>
 #include <algorithm>
 #include <cstdlib>
 #include <cmath>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <iostream>
@@ -39,6 +43,13 @@ static bool _groundCanvasReady = false;
 // into the render texture once it becomes available.
 static std::vector<std::pair<sf::VertexArray, const sf::Texture*>> _pendingGroundQuads;
 
+// Held while the canvas is created or stamped, and while the ground is drawn. Only contended when the
+// render thread draws the world while the simulation stamps decals.
+static std::mutex& groundCanvasMutex() {
+    static std::mutex m;
+    return m;
+}
+
 // Helper that calls RenderTexture::create while suppressing the deprecation warning
 static bool createGroundCanvas(unsigned int w, unsigned int h)
 {
@@ -201,6 +212,7 @@ void Explosion::setTexture(const sf::Texture& tex) {
 // Allow Game to initialize ground canvas to map pixel size so decals align with world coords
 void Explosion::setGroundCanvasSize(unsigned int width, unsigned int height) {
     if (width == 0 || height == 0) return;
+    std::lock_guard<std::mutex> lock(groundCanvasMutex());
     // recreate if not ready or size differs
     sf::Vector2u existing = _groundCanvas.getTexture().getSize();
     if (_groundCanvasReady && existing.x == width && existing.y == height) return;
@@ -221,8 +233,9 @@ void Explosion::update(void* world){
     _ratio = std::max(0.0f, _ratio);
 }
 
-void Explosion::render(sf::RenderWindow& window) {
+void Explosion::render(RenderQueue& queue) {
     if (_ratio > 0) {
+        std::lock_guard<std::mutex> lock(groundCanvasMutex());
         bool hasTex = (_isBlood && Explosion::_texture.getSize().x > 0);
         const float maxDistSq = _maxAllowedDrawDistance * _maxAllowedDrawDistance;
 
@@ -312,7 +325,7 @@ void Explosion::render(sf::RenderWindow& window) {
                     s.setRotation(rotDeg);
                     s.setColor(p._color);
                     s.setPosition(x, y);
-                    window.draw(s);
+                    queue.submitSprite(RenderLayer::Particles, s);
                 }
             }
             else {
@@ -341,11 +354,11 @@ void Explosion::render(sf::RenderWindow& window) {
                             addQuadToGroundCanvas(quad);
                         }
                         else {
-                            window.draw(quad);
+                            queue.submitQuads(RenderLayer::Particles, nullptr, sf::BlendAlpha, &quad[0], 4);
                         }
                     }
                     else {
-                        window.draw(quad);
+                        queue.submitQuads(RenderLayer::Particles, nullptr, sf::BlendAlpha, &quad[0], 4);
                     }
                 }
                 else
@@ -361,7 +374,7 @@ void Explosion::render(sf::RenderWindow& window) {
                         }
                     }
                     if (_groundCanvasReady) addQuadToGroundCanvas(quad);
-                    else window.draw(quad);
+                    else queue.submitQuads(RenderLayer::Particles, nullptr, sf::BlendAlpha, &quad[0], 4);
                 }
             }
         }
@@ -371,6 +384,7 @@ void Explosion::render(sf::RenderWindow& window) {
 // commitToGround: also guard outliers when stamping
 void Explosion::commitToGround() {
     if (_committedToGround) return;
+    std::lock_guard<std::mutex> lock(groundCanvasMutex());
     bool hasTex = (_isBlood && Explosion::_texture.getSize().x > 0 && Explosion::_texture.getSize().y > 0);
     const float maxDistSq = _maxAllowedDrawDistance * _maxAllowedDrawDistance;
     for (const Particle& p : _particles) {
@@ -445,14 +459,45 @@ void Explosion::updateAll(float dt){
     }
 }
 
-void Explosion::renderAll(sf::RenderWindow& window){
-    for (auto e: _active) e->render(window);
+void Explosion::stampToGround(const sf::Sprite& sprite) {
+    const sf::Texture* tex = sprite.getTexture();
+    if (!tex) return;
+    std::lock_guard<std::mutex> lock(groundCanvasMutex());
+    // Build the sprite's quad in world space so it goes through the same path (and pending queue) as decals
+    const sf::IntRect r = sprite.getTextureRect();
+    const sf::FloatRect lb = sprite.getLocalBounds();
+    const sf::Transform& t = sprite.getTransform();
+    sf::VertexArray quad(sf::Quads, 4);
+    quad[0].position = t.transformPoint(0.f, 0.f);
+    quad[1].position = t.transformPoint(lb.width, 0.f);
+    quad[2].position = t.transformPoint(lb.width, lb.height);
+    quad[3].position = t.transformPoint(0.f, lb.height);
+    const float l = static_cast<float>(r.left), tp = static_cast<float>(r.top);
+    const float rr = static_cast<float>(r.left + r.width), b = static_cast<float>(r.top + r.height);
+    quad[0].texCoords = sf::Vector2f(l, tp);
+    quad[1].texCoords = sf::Vector2f(rr, tp);
+    quad[2].texCoords = sf::Vector2f(rr, b);
+    quad[3].texCoords = sf::Vector2f(l, b);
+    for (size_t i = 0; i < 4; ++i) quad[i].color = sprite.getColor();
+    addQuadToGroundCanvas(quad, tex);
+}
+
+sf::FloatRect Explosion::getBounds() const {
+    const float r = _maxAllowedDrawDistance + _size;
+    return sf::FloatRect(_cx - r, _cy - r, r * 2.f, r * 2.f);
 }
 
-void Explosion::renderGround(sf::RenderWindow& window) {
+void Explosion::renderAll(RenderQueue& queue, ViewCuller& culler){
+    for (auto e: _active) {
+        if (e->_committedToGround) continue; // lives on in the ground canvas only
+        if (culler.accept(ViewCuller::Category::Explosions, e->getBounds())) e->render(queue);
+    }
+}
+
+void Explosion::renderGround(RenderQueue& queue, const sf::View& v) {
+    std::lock_guard<std::mutex> lock(groundCanvasMutex());
     if (_groundCanvasReady) {
         // compute current view rect in world coords
-        sf::View v = window.getView();
         sf::FloatRect viewRect(v.getCenter().x - v.getSize().x*0.5f, v.getCenter().y - v.getSize().y*0.5f, v.getSize().x, v.getSize().y);
         // texture size
         sf::Vector2u ts = _groundCanvas.getTexture().getSize();
@@ -473,11 +518,20 @@ void Explosion::renderGround(sf::RenderWindow& window) {
                 groundSprite.setTextureRect(sf::IntRect(left, top, w, h));
                 // position sprite at world coordinates matching the sub-rect
                 groundSprite.setPosition(static_cast<float>(left), static_cast<float>(top));
-                // draw the ground sprite
-                window.draw(groundSprite);
+                // draw the ground sprite; the command may run on the render thread, so it takes the canvas lock
+                queue.submitCommand(RenderLayer::GroundDecals, [groundSprite](InstrumentedTarget& target) {
+                    std::lock_guard<std::mutex> drawLock(groundCanvasMutex());
+                    target.draw(groundSprite);
+                });
             }
         }
         _groundCanvas.display();
+        // The render thread samples the canvas from its own GL context: submit this frame's stamping
+        // here so it is visible there (the lock only orders the CPU side)
+        if (_groundCanvas.setActive(true)) {
+            glFlush();
+            _groundCanvas.setActive(false);
+        }
     }
 }
 
@@ -0,0 +1,195 @@
+#include "FlashEmitter.h"
+#include "RenderQueue.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // The flash art is box-filtered down to this cell; on screen it is a few dozen pixels wide
+    const unsigned kFlashCell = 128;
+    // Tracer streak cell: transparent tail on the left, bright head on the right
+    const unsigned kTracerWidth = 64;
+    const unsigned kTracerHeight = 8;
+    const unsigned kGap = 2; // keeps smooth filtering from bleeding between cells
+
+    void boxDownsample(const sf::Image& src, sf::Image& dst, unsigned dstX, unsigned dstY, unsigned cell) {
+        sf::Vector2u size = src.getSize();
+        for (unsigned y = 0; y < cell; ++y) {
+            unsigned y0 = y * size.y / cell, y1 = std::max(y0 + 1, (y + 1) * size.y / cell);
+            for (unsigned x = 0; x < cell; ++x) {
+                unsigned x0 = x * size.x / cell, x1 = std::max(x0 + 1, (x + 1) * size.x / cell);
+                // colour weighted by alpha so transparent texels don't darken the edges
+                float r = 0.0f, g = 0.0f, b = 0.0f, a = 0.0f;
+                for (unsigned sy = y0; sy < y1; ++sy) {
+                    for (unsigned sx = x0; sx < x1; ++sx) {
+                        sf::Color c = src.getPixel(sx, sy);
+                        float w = c.a / 255.0f;
+                        r += c.r * w; g += c.g * w; b += c.b * w; a += w;
+                    }
+                }
+                float n = static_cast<float>((x1 - x0) * (y1 - y0));
+                sf::Color out = sf::Color::Transparent;
+                if (a > 0.0f) {
+                    out = sf::Color(static_cast<sf::Uint8>(r / a), static_cast<sf::Uint8>(g / a),
+                                    static_cast<sf::Uint8>(b / a), static_cast<sf::Uint8>(255.0f * a / n));
+                }
+                dst.setPixel(dstX + x, dstY + y, out);
+            }
+        }
+    }
+
+    void appendQuad(std::vector<sf::Vertex>& out, const sf::Vector2f* corners, const sf::FloatRect& tex, const sf::Color& color) {
+        out.emplace_back(corners[0], color, sf::Vector2f(tex.left, tex.top));
+        out.emplace_back(corners[1], color, sf::Vector2f(tex.left + tex.width, tex.top));
+        out.emplace_back(corners[2], color, sf::Vector2f(tex.left + tex.width, tex.top + tex.height));
+        out.emplace_back(corners[3], color, sf::Vector2f(tex.left, tex.top + tex.height));
+    }
+}
+
+void FlashEmitter::setFlashTexture(const sf::Texture& source) {
+    sf::Image image = source.copyToImage();
+    hasFlashImage = image.getSize().x > 0 && image.getSize().y > 0;
+    if (hasFlashImage) {
+        flashCell.create(kFlashCell, kFlashCell, sf::Color::Transparent);
+        boxDownsample(image, flashCell, 0, 0, kFlashCell);
+        flashSourceWidth = static_cast<float>(image.getSize().x);
+    }
+    textureReady = false;
+    ensureTexture();
+}
+
+void FlashEmitter::ensureTexture() {
+    if (textureReady) return;
+
+    unsigned width = kFlashCell + kGap + kTracerWidth;
+    sf::Image image;
+    image.create(width, kFlashCell, sf::Color::Transparent);
+    if (hasFlashImage) image.copy(flashCell, 0, 0);
+
+    // Tracer: alpha ramps up towards the head and falls off across the width
+    unsigned tracerX = kFlashCell + kGap;
+    for (unsigned y = 0; y < kTracerHeight; ++y) {
+        float across = 1.0f - std::abs(2.0f * (y + 0.5f) / kTracerHeight - 1.0f);
+        for (unsigned x = 0; x < kTracerWidth; ++x) {
+            float along = std::pow((x + 0.5f) / kTracerWidth, 1.5f);
+            image.setPixel(tracerX + x, y, sf::Color(255, 235, 180, static_cast<sf::Uint8>(255.0f * along * across)));
+        }
+    }
+
+    if (!texture.loadFromImage(image)) return;
+    texture.setSmooth(true);
+    flashRect = sf::FloatRect(0.0f, 0.0f, static_cast<float>(kFlashCell), static_cast<float>(kFlashCell));
+    tracerRect = sf::FloatRect(static_cast<float>(tracerX), 0.0f, static_cast<float>(kTracerWidth), static_cast<float>(kTracerHeight));
+    textureReady = true;
+}
+
+FlashEmitter::Particle& FlashEmitter::allocate() {
+    Particle& p = particles[next];
+    next = (next + 1) % kCapacity;
+    if (p.kind == Kind::None) ++activeCount;
+    return p;
+}
+
+void FlashEmitter::emitFlash(const sf::Vector2f& position, float rotationDeg, float scale, float life) {
+    if (!hasFlashImage || life <= 0.0f) return;
+    Particle& p = allocate();
+    p.kind = Kind::Flash;
+    p.position = position;
+    p.velocity = sf::Vector2f();
+    p.rotation = rotationDeg;
+    // scale is relative to the source art; the cell is smaller
+    p.size = scale * flashSourceWidth / static_cast<float>(kFlashCell);
+    p.age = 0.0f;
+    p.life = life;
+}
+
+void FlashEmitter::emitTracer(const sf::Vector2f& position, const sf::Vector2f& velocity, float life, float length, float width) {
+    if (life <= 0.0f) return;
+    Particle& p = allocate();
+    p.kind = Kind::Tracer;
+    p.position = position;
+    p.velocity = velocity;
+    p.rotation = 0.0f;
+    p.size = length;
+    p.width = width;
+    p.age = 0.0f;
+    p.life = life;
+}
+
+void FlashEmitter::update(float dt) {
+    lastStep = dt;
+    if (activeCount == 0) return;
+    for (Particle& p : particles) {
+        if (p.kind == Kind::None) continue;
+        p.age += dt;
+        if (p.age >= p.life) {
+            p.kind = Kind::None;
+            --activeCount;
+        }
+    }
+}
+
+void FlashEmitter::clearFlashes() {
+    for (Particle& p : particles) {
+        if (p.kind != Kind::Flash) continue;
+        p.kind = Kind::None;
+        --activeCount;
+    }
+}
+
+void FlashEmitter::clear() {
+    for (Particle& p : particles) p.kind = Kind::None;
+    activeCount = 0;
+}
+
+void FlashEmitter::buildVertices(float alpha) {
+    vertices.clear();
+    if (activeCount == 0) return;
+    ensureTexture();
+    if (!textureReady) return;
+
+    // Render between the previous step and the current one
+    float rewind = (1.0f - std::min(std::max(alpha, 0.0f), 1.0f)) * lastStep;
+    for (const Particle& p : particles) {
+        if (p.kind == Kind::None) continue;
+        float age = std::max(0.0f, p.age - rewind);
+        float elapsed = std::min(age / p.life, 1.0f);
+        sf::Vector2f corners[4];
+
+        if (p.kind == Kind::Flash) {
+            // linear fade, with a slight scale pop that peaks mid-life
+            sf::Color color(255, 255, 255, static_cast<sf::Uint8>(255.0f * (1.0f - elapsed)));
+            float pop = std::max(0.0f, std::sin(3.14159265f * elapsed));
+            float half = 0.5f * kFlashCell * p.size * (0.6f + 0.4f * pop);
+            float rad = p.rotation * 3.14159265f / 180.0f;
+            sf::Vector2f ax(std::cos(rad) * half, std::sin(rad) * half);
+            sf::Vector2f ay(-ax.y, ax.x);
+            corners[0] = p.position - ax - ay;
+            corners[1] = p.position + ax - ay;
+            corners[2] = p.position + ax + ay;
+            corners[3] = p.position - ax + ay;
+            appendQuad(vertices, corners, flashRect, color);
+        } else {
+            float speed = std::sqrt(p.velocity.x * p.velocity.x + p.velocity.y * p.velocity.y);
+            if (speed < 1e-3f) continue;
+            sf::Vector2f dir = p.velocity / speed;
+            // the tail never reaches back past the muzzle
+            float length = std::min(p.size, speed * age);
+            if (length < 1.0f) continue;
+            sf::Vector2f head = p.position + p.velocity * age;
+            sf::Vector2f tail = head - dir * length;
+            sf::Vector2f side(-dir.y * 0.5f * p.width, dir.x * 0.5f * p.width);
+            sf::Color color(255, 255, 255, static_cast<sf::Uint8>(255.0f * (1.0f - elapsed)));
+            corners[0] = tail - side;
+            corners[1] = head - side;
+            corners[2] = head + side;
+            corners[3] = tail + side;
+            appendQuad(vertices, corners, tracerRect, color);
+        }
+    }
+}
+
+void FlashEmitter::submit(RenderQueue& queue, float alpha) {
+    buildVertices(alpha);
+    if (vertices.empty()) return;
+    queue.submitQuads(RenderLayer::MuzzleEffects, &texture, sf::BlendAdd, vertices.data(), vertices.size());
+}
@@ -2,14 +2,17 @@
 #include "Explosion.h"
 #include "Guts.h"
 #include "ExplosionProvider.h"
+#include "TextureAtlas.h"
+#include "DebugDraw.h"
+#include "GameRandom.h"
+#include "TransformBuffer.h"
 #include <iostream>
 #include <algorithm>
 #include <random>
 #include <cmath>
 #include <chrono>
-
-// Forward declaration for OBB vs AABB helper used by collision checks
-static bool obbIntersectsAabb(const sf::Vector2f& c, const sf::Vector2f& he, float rotDeg, const sf::FloatRect& aabb);
+#include <sstream>
+#include <iomanip>
 
 // Back button margin from panel edge (keeps it fully inside) - same as scene.cpp
 static constexpr float BACK_PANEL_MARGIN = 12.f;
@@ -18,7 +21,7 @@ static constexpr float BACK_PANEL_MARGIN = 12.f;
 static sf::FloatRect s_victoryExitRect(0.f, 0.f, 0.f, 0.f);
 static bool s_victoryWasHovered = false;
 
-Game::Game()
+Game::Game(const sf::Vector2u& offscreenSize)
     : window(),
     player(Vec2(400, 300)),
     points(0),
@@ -28,10 +31,22 @@ Game::Game()
     gameOverFadeDuration(1.5f) // 1.5 seconds for game over fade
 {
     // Create fullscreen window using desktop resolution and use letter/pillarbox
-    // so content isn't stretched.
-    sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
-    window.create(desktop, "Echoes of Valkyrie", sf::Style::Fullscreen);
-    window.setFramerateLimit(60);
+    // so content isn't stretched. Headless, the offscreen texture stands in for the window.
+    headless = offscreenSize.x > 0 && offscreenSize.y > 0;
+    sf::VideoMode desktop = headless ? sf::VideoMode(offscreenSize.x, offscreenSize.y) : sf::VideoMode::getDesktopMode();
+    if (headless) {
+        if (!offscreen.create(desktop.width, desktop.height)) {
+            std::cerr << "Error creating " << desktop.width << "x" << desktop.height << " offscreen target" << std::endl;
+        }
+    } else {
+        window.create(desktop, "Echoes of Valkyrie", sf::Style::Fullscreen);
+        window.setFramerateLimit(60);
+    }
+
+    // Offscreen world target for dynamic resolution (the world is drawn straight to the window without it)
+    worldTextureReady = worldRenderTexture.create(desktop.width, desktop.height);
+    if (worldTextureReady) worldRenderTexture.setSmooth(true);
+    else std::cerr << "Error creating world render texture; dynamic resolution disabled" << std::endl;
     // Hide OS cursor; we'll draw a small dot as the custom cursor
     window.setMouseCursorVisible(false);
 
@@ -55,11 +70,9 @@ Game::Game()
     if (!mapTexture1.loadFromFile("assets/Map/ground1.jpg")) {
         std::cerr << "Error loading map1 texture!" << std::endl;
     } else {
-        // This texture is a single tile (512x512). Enable repeating and
-        // instruct the sprite to cover the full map area (2560x2560).
-        mapTexture1.setRepeated(true);
-        mapSprite1.setTexture(mapTexture1);
-        mapSprite1.setTextureRect(sf::IntRect(0, 0, 2560, 2560));
+        // This texture is a single tile (512x512). The map covers the full
+        // area (2560x2560) with one quad per tile, grouped into chunks.
+        map1.buildTiled(mapTexture1, getMapSize(1));
         int startLevelForCanvas = levelManager.getCurrentLevel();
         sf::Vector2u initialMapSize = getMapSize(startLevelForCanvas);
         Props::Explosion::setGroundCanvasSize(initialMapSize.x, initialMapSize.y);
@@ -76,10 +89,34 @@ Game::Game()
     pointsText.setCharacterSize(24);
     pointsText.setFillColor(sf::Color::White);
     pointsText.setPosition(10, 10);
+
+    perfText.setFont(font2);
+    perfText.setCharacterSize(16);
+    perfText.setFillColor(sf::Color::White);
+    perfText.setOutlineColor(sf::Color::Black);
+    perfText.setOutlineThickness(1.f);
+
+    // The titles scale with the window (up to 300 px); one SDF atlas covers every size
+    titleFont.loadFromFont(font, true);
+    prewarmFonts();
     
     physics.addBody(&player.getBody(), false);
 
     levelManager.setPhysicsWorld(&physics);
+    player.setNoiseField(&levelManager.getNoiseField());
+
+    // Combat side effects owned by Game. Dead zombies are recycled by LevelManager on its next update.
+    combat.setOnZombieKilled([this](BaseZombie&) {
+        points += 10;
+        // The horde is endless: kills never advance the level
+        if (levelManager.getCurrentState() == GameState::HORDE) return;
+        zombiesToNextLevel--;
+        if (zombiesToNextLevel <= 0) {
+            levelManager.nextLevel();
+            zombiesToNextLevel = 15;
+        }
+    });
+    combat.setOnPlayerBitten([this](BaseZombie&, float) { playZombieBite(); });
     physics.setDebugLogging(false);
     levelManager.setDebugLogging(false);
     levelManager.initialize();
@@ -193,8 +230,24 @@ Game::Game()
     std::array<int,5> frameW = { idleW, walkW, runW, strafeLeftW, strafeRightW };
     std::array<int,5> frameH = { idleH, walkH, runH, strafeLeftH, strafeRightH };
 
+    // Frames packed by tools/AtlasPacker are preferred; the loose sheets below are the fallback
+    const TextureAtlas& atlas = TextureAtlas::shared();
+    std::array<std::string,5> feetAtlasNames = { "feet_idle", "feet_walk", "feet_run", "feet_strafe_left", "feet_strafe_right" };
+
     // Load each and set state sheets (auto-slice full grid; no framesPerRow overrides)
     for (int s = 0; s < 5; ++s) {
+        const sf::Texture* atlasPage = nullptr;
+        std::vector<sf::IntRect> atlasFrames;
+        if (atlas.getSequence(feetAtlasNames[s], atlasPage, atlasFrames)) {
+            FeetState fs = static_cast<FeetState>(s);
+            if (fs == FeetState::IDLE) {
+                atlasFrames.resize(1);
+                player.setFeetStateSheet(fs, *atlasPage, atlasFrames, 0.1f);
+            } else {
+                player.setFeetStateSheet(fs, *atlasPage, atlasFrames, (fs == FeetState::RUN) ? 0.035f : 0.055f);
+            }
+            continue;
+        }
         if (playerFeetStateTextures[s].loadFromFile(feetPaths[s])) {
             std::vector<sf::IntRect> frames;
             int w = frameW[s];
@@ -253,9 +306,17 @@ Game::Game()
         return out;
     };
 
+    // Atlas sequences share the sheet names (hunter_pistol_idle, ...)
+    auto atlasName = [](const std::string& path) {
+        size_t slash = path.find_last_of('/');
+        return path.substr(slash + 1, path.size() - slash - 1 - 4); // strip directory and ".png"
+    };
+
     // Load pistol sheets and frames
     std::vector<std::vector<sf::IntRect>> pistolFrames(4);
+    std::array<const sf::Texture*,4> pistolSheetPtrs = { &playerPistolSheets[0], &playerPistolSheets[1], &playerPistolSheets[2], &playerPistolSheets[3] };
     for (int i = 0; i < 4; ++i) {
+        if (atlas.getSequence(atlasName(pistolPaths[i]), pistolSheetPtrs[i], pistolFrames[i])) continue;
         if (playerPistolSheets[i].loadFromFile(pistolPaths[i])) {
             int w = pistolFrameW[i];
             int h = pistolFrameH[i];
@@ -263,20 +324,19 @@ Game::Game()
         } else std::cerr << "Could not load pistol sheet: " << pistolPaths[i] << std::endl;
     }
 
-    // Build pointer arrays for pistol and rifle sheets
-    std::array<const sf::Texture*,4> pistolSheetPtrs = { &playerPistolSheets[0], &playerPistolSheets[1], &playerPistolSheets[2], &playerPistolSheets[3] };
     player.setUpperWeaponSheet(WeaponType::PISTOL, pistolSheetPtrs, pistolFrames, pistolTimes);
 
     // Load rifle sheets and frames
     std::vector<std::vector<sf::IntRect>> rifleFrames(4);
+    std::array<const sf::Texture*,4> rifleSheetPtrs = { &playerRifleSheets[0], &playerRifleSheets[1], &playerRifleSheets[2], &playerRifleSheets[3] };
     for (int i = 0; i < 4; ++i) {
+        if (atlas.getSequence(atlasName(riflePaths[i]), rifleSheetPtrs[i], rifleFrames[i])) continue;
         if (playerRifleSheets[i].loadFromFile(riflePaths[i])) {
             int w = rifleFrameW[i];
             int h = rifleFrameH[i];
             rifleFrames[i] = buildFrames(playerRifleSheets[i], w, h);
         } else std::cerr << "Could not load rifle sheet: " << riflePaths[i] << std::endl;
     }
-    std::array<const sf::Texture*,4> rifleSheetPtrs = { &playerRifleSheets[0], &playerRifleSheets[1], &playerRifleSheets[2], &playerRifleSheets[3] };
     player.setUpperWeaponSheet(WeaponType::RIFLE, rifleSheetPtrs, rifleFrames, rifleTimes);
 
     // Load icon textures for pause controls panel to match scene icons
@@ -371,21 +431,33 @@ Game::Game()
     // Initialize ExplosionProvider (precomputes random tables and Guts)
     ExplosionProvider::initProvider();
 
-    // Load desaturation shader (used to grey-out world as health decreases)
+    // Load the post-process shader: one pass over the world composite that greys it out as health
+    // decreases, lays the blood overlay on top and dims it for game over
     const std::string fragShader = R"(
         uniform sampler2D texture;
+        uniform sampler2D u_bloodTex;
+        uniform vec2 u_screenSize;
         uniform float u_desat; // 0 = full color, 1 = grayscale
+        uniform float u_blood; // blood overlay opacity
+        uniform float u_fade;  // 0 = none, 1 = black
         void main()
         {
             vec4 col = texture2D(texture, gl_TexCoord[0].xy);
             float lum = dot(col.rgb, vec3(0.2126, 0.7152, 0.0722));
-            vec3 gray = vec3(lum);
-            vec3 outcol = mix(col.rgb, gray, clamp(u_desat, 0.0, 1.0));
+            vec3 outcol = mix(col.rgb, vec3(lum), clamp(u_desat, 0.0, 1.0));
+            // the overlay is stretched over the window (window y runs bottom-up)
+            vec2 screen = vec2(gl_FragCoord.x / u_screenSize.x, 1.0 - gl_FragCoord.y / u_screenSize.y);
+            vec4 blood = texture2D(u_bloodTex, screen);
+            outcol = mix(outcol, blood.rgb, clamp(blood.a * u_blood, 0.0, 1.0));
+            outcol = mix(outcol, vec3(0.0), clamp(u_fade, 0.0, 1.0));
             gl_FragColor = vec4(outcol, col.a);
         }
     )";
-    desaturateShaderLoaded = desaturateShader.loadFromMemory(fragShader, sf::Shader::Fragment);
-    if (desaturateShaderLoaded) desaturateShader.setUniform("u_desat", 0.f);
+    postShaderLoaded = sf::Shader::isAvailable() && postShader.loadFromMemory(fragShader, sf::Shader::Fragment);
+    if (postShaderLoaded) {
+        postShader.setUniform("texture", sf::Shader::CurrentTexture);
+        if (bloodTexture.getSize().x > 0) postShader.setUniform("u_bloodTex", bloodTexture);
+    }
 
     // Load placeholder tally textures for round indicators (0..4)
     for (int i = 0; i < 5; ++i) {
@@ -419,18 +491,21 @@ void Game::run() {
     float accumulator = 0.0f;
     sf::Clock frameClock;
 
+    if (renderThreadEnabled && !renderThread.start(screen().getSize())) {
+        std::cerr << "Render thread unavailable, rendering on the main thread" << std::endl;
+        renderThreadEnabled = false;
+    }
+
     // Simple profiler accumulators (low-overhead)
     using clock = std::chrono::steady_clock;
-    static double physicsTimeMs = 0.0;
-    static double levelTimeMs = 0.0;
-    static double renderTimeMs = 0.0;
-    static uint32_t samples = 0;
-    static auto windowStart = clock::now();
+    auto windowStart = clock::now();
     const double sampleWindowSec = 5.0;
 
     while (window.isOpen()) {
+        frameTimings = ProfilerTimings();
         processInput();
         float deltaTime = frameClock.restart().asSeconds();
+        frameTimings.frame = deltaTime * 1000.0;
 
         // If game is paused, reset accumulator so physics doesn't catch up while paused
         if (paused) {
@@ -467,24 +542,57 @@ void Game::run() {
         auto r0 = clock::now();
         render();
         auto r1 = clock::now();
-        renderTimeMs += std::chrono::duration<double, std::milli>(r1 - r0).count();
+        RenderStats::instance().endFrame();
+        frameTimings.render = std::chrono::duration<double, std::milli>(r1 - r0).count();
 
         // Count this frame as a sample
-        samples++;
+        profilerSamples++;
+        windowTimings.frame += frameTimings.frame;
+        windowTimings.physics += frameTimings.physics;
+        windowTimings.level += frameTimings.level;
+        windowTimings.ai += frameTimings.ai;
+        windowTimings.reorder += frameTimings.reorder;
+        windowTimings.render += frameTimings.render;
+
+        // Exponential moving average for the live readout so numbers are readable frame to frame
+        const double smooth = 0.1;
+        smoothedTimings.frame += (frameTimings.frame - smoothedTimings.frame) * smooth;
+        smoothedTimings.physics += (frameTimings.physics - smoothedTimings.physics) * smooth;
+        smoothedTimings.level += (frameTimings.level - smoothedTimings.level) * smooth;
+        smoothedTimings.ai += (frameTimings.ai - smoothedTimings.ai) * smooth;
+        smoothedTimings.reorder += (frameTimings.reorder - smoothedTimings.reorder) * smooth;
+        smoothedTimings.render += (frameTimings.render - smoothedTimings.render) * smooth;
+        updateWorldScale(deltaTime);
 
         // Print profiling summary every sampleWindowSec seconds
         auto now = clock::now();
         double elapsedSec = std::chrono::duration<double>(now - windowStart).count();
         if (elapsedSec >= sampleWindowSec) {
-            double avgPhysics = (samples > 0) ? physicsTimeMs / samples : 0.0;
-            double avgLevel = (samples > 0) ? levelTimeMs / samples : 0.0;
-            double avgRender = (samples > 0) ? renderTimeMs / samples : 0.0;
+            uint32_t samples = profilerSamples;
+            double avgFrame = (samples > 0) ? windowTimings.frame / samples : 0.0;
+            double avgPhysics = (samples > 0) ? windowTimings.physics / samples : 0.0;
+            double avgLevel = (samples > 0) ? windowTimings.level / samples : 0.0;
+            double avgAI = (samples > 0) ? windowTimings.ai / samples : 0.0;
+            double avgReorder = (samples > 0) ? windowTimings.reorder / samples : 0.0;
+            double avgRender = (samples > 0) ? windowTimings.render / samples : 0.0;
             std::cout << "[Profiler] samples=" << samples
+                      << " avgFrame(ms)=" << avgFrame
                       << " avgPhysics(ms)=" << avgPhysics
                       << " avgLevel(ms)=" << avgLevel
+                      << " avgAI(ms)=" << avgAI
+                      << " avgReorder(ms)=" << avgReorder
+                      << " morton=" << (levelManager.isMortonOrderingEnabled() ? "on" : "off")
                       << " avgRender(ms)=" << avgRender
                       << " activeZombies=" << levelManager.getActiveZombieCount()
                       << " queuedZombies=" << levelManager.getQueuedZombieCount();
+            for (size_t i = 0; i < static_cast<size_t>(RenderPass::Count); ++i) {
+                const RenderPass pass = static_cast<RenderPass>(i);
+                const RenderStats::Averages& a = RenderStats::instance().getAverage(pass);
+                if (a.draws < 0.5) continue;
+                std::cout << " " << RenderStats::getName(pass) << "(draws/verts/tex/blend)="
+                          << std::lround(a.draws) << "/" << std::lround(a.vertices) << "/"
+                          << std::lround(a.textureChanges) << "/" << std::lround(a.blendChanges);
+            }
             if (&physics) {
                 std::cout << " physicsBodies=" << physics.getDynamicBodyCount()
                           << " lastChecks=" << physics.getLastCollisionChecks();
@@ -492,13 +600,13 @@ void Game::run() {
             std::cout << std::endl;
 
             // reset counters
-            samples = 0;
-            physicsTimeMs = 0.0;
-            levelTimeMs = 0.0;
-            renderTimeMs = 0.0;
+            profilerSamples = 0;
+            windowTimings = ProfilerTimings();
             windowStart = now;
         }
     }
+
+    renderThread.stop();
 }
 
 void Game::processInput() {
@@ -516,7 +624,7 @@ void Game::processInput() {
                 if (st == GameState::TUTORIAL && levelManager.isRequireEscToAdvanceDialog()) {
                     levelManager.advanceDialog();
                 }
-                if (st == GameState::TUTORIAL || (st >= GameState::LEVEL1 && st <= GameState::LEVEL5)) {
+                if (st == GameState::TUTORIAL || (st >= GameState::LEVEL1 && st <= GameState::LEVEL5) || st == GameState::HORDE) {
                     if (paused && showingControls) {
                         showingControls = false;
                         window.setMouseCursorVisible(true);
@@ -545,7 +653,21 @@ void Game::processInput() {
                 if (!levelManager.isRequireEscToAdvanceDialog()) levelManager.advanceDialog();
             }
             if (event.key.code == sf::Keyboard::R) player.startReload();
-            //if (event.key.code == sf::Keyboard::Tilde) debugDrawHitboxes = !debugDrawHitboxes;
+#ifdef TDCOD_DEBUG_DRAW
+            if (event.key.code == sf::Keyboard::Tilde) {
+                debugDrawHitboxes = !debugDrawHitboxes;
+                DebugDraw::setEnabled(debugDrawHitboxes);
+            }
+#endif
+            if (event.key.code == sf::Keyboard::F3) showPerfOverlay = !showPerfOverlay;
+            if (event.key.code == sf::Keyboard::F4) {
+                // Toggle Morton ordering and start a fresh profiler window so the next summary
+                // only contains samples from the new setting (before/after comparison)
+                levelManager.setMortonOrderingEnabled(!levelManager.isMortonOrderingEnabled());
+                profilerSamples = 0;
+                windowTimings = ProfilerTimings();
+                std::cout << "[Profiler] morton ordering " << (levelManager.isMortonOrderingEnabled() ? "on" : "off") << std::endl;
+            }
             if (event.key.code == sf::Keyboard::Num1) player.setWeapon(WeaponType::RIFLE);
             if (event.key.code == sf::Keyboard::Num2) player.setWeapon(WeaponType::PISTOL);
         }
@@ -753,8 +875,10 @@ void Game::processInput() {
 }
 
 void Game::update(float deltaTime) {
-    sf::Vector2i mousePosition = sf::Mouse::getPosition(window);
-    sf::Vector2f worldMousePosition = window.mapPixelToCoords(mousePosition, gameView);
+    // Current positions become previous ones for every interpolated entity before anything moves
+    TransformBuffer::instance().beginStep();
+
+    sf::Vector2f worldMousePosition = getWorldMousePosition();
 
     int currentLevel = levelManager.getCurrentLevel();
     sf::Vector2u mapSize = getMapSize(currentLevel);
@@ -766,9 +890,9 @@ void Game::update(float deltaTime) {
 
     auto u1 = clock::now();
 
-    // Centralize input-driven states: pass sprint/aim intent into Player
-    bool wantsToAim = sf::Mouse::isButtonPressed(sf::Mouse::Right);
-    bool wantsToSprint = sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || sf::Keyboard::isKeyPressed(sf::Keyboard::RShift);
+    // Centralize input-driven states: pass sprint/aim intent into Player (scripted runs ignore live input)
+    bool wantsToAim = !scripted && sf::Mouse::isButtonPressed(sf::Mouse::Right);
+    bool wantsToSprint = !scripted && (sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || sf::Keyboard::isKeyPressed(sf::Keyboard::RShift));
     player.setAiming(wantsToAim);
     player.sprint(wantsToSprint);
 
@@ -815,7 +939,7 @@ void Game::update(float deltaTime) {
 
     // Automatic fire for rifle: allow continuous shooting while left mouse button is held.
     // Pistol remains single-shot
-    if (sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
+    if (!scripted && sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
         if (player.getCurrentWeapon() == WeaponType::RIFLE && player.timeSinceLastShot >= player.fireCooldown) {
             player.shoot(worldMousePosition, physics, bullets);
         }
@@ -881,15 +1005,12 @@ void Game::update(float deltaTime) {
 
     auto u2 = clock::now();
 
-    // accumulate measured times into Game::run static accumulators
+    // accumulate measured times into this frame's profiler timings (summed over the fixed steps run this frame)
     using msd = std::chrono::duration<double, std::milli>;
-    extern double physicsTimeMs; // forward to static in run (can't access directly); workaround: use static locals in run scope? Simpler: store to global statics defined above in anonymous namespace
-
-    // Instead of extern, use static globals defined here to accumulate
-    static double localPhysicsAccum = 0.0;
-    static double localLevelAccum = 0.0;
-    localPhysicsAccum += msd(u1 - u0).count();
-    localLevelAccum += msd(u2 - u1).count();
+    frameTimings.physics += msd(u1 - u0).count();
+    frameTimings.level += msd(u2 - u1).count();
+    frameTimings.ai += levelManager.getLastZombieUpdateMs();
+    frameTimings.reorder += levelManager.getLastMortonReorderMs();
 
     // debug
     if (levelManager.getDebugLogging()) {
@@ -898,20 +1019,45 @@ void Game::update(float deltaTime) {
                   << std::endl;
     }
 
-    checkZombiePlayerCollisions();
+    combat.resolve(player, levelManager.getZombies());
     checkPlayerBoundaries();
 }
 
+void Game::prewarmFonts() {
+    // Sizes derived from the window height match the ones computed in render()/drawVictoryScreen()
+    const float winH = static_cast<float>(screen().getSize().y);
+    const unsigned pauseSize = static_cast<unsigned>(std::min(160.f, winH / 15.f));
+    const unsigned itemSize = static_cast<unsigned>(std::min(124.f, winH * 0.08f));
+    const unsigned exitSize = static_cast<unsigned>(std::max(70.f, winH * 0.055f));
+    // An outlined sf::Text uses both the plain and the outlined glyphs
+    prewarmGlyphs(font, {
+        { 24, false, 0.f },                                 // points
+        { 36, false, 0.f },                                 // Back buttons, panel headers
+        { 52, false, 0.f },                                 // panel titles
+        { pauseSize, false, 0.f }, { pauseSize, true, 0.f }, // pause menu
+        { itemSize, true, 0.f }, { itemSize, true, 2.f },   // game over menu
+        { exitSize, true, 0.f }, { exitSize, true, 2.f },   // victory EXIT
+        { 12, false, 0.f }                                  // reload key fallback letter
+    });
+    if (!font2.getInfo().family.empty()) {
+        prewarmGlyphs(font2, {
+            { 24, false, 0.f }, { 20, false, 0.f }, { 18, false, 0.f }, // controls/settings labels
+            { 16, false, 0.f }, { 16, false, 1.f },                     // perf overlay
+            { 12, false, 0.f }, { 12, false, 1.f }                      // reload prompt
+        });
+    }
+}
+
 void Game::drawVictoryScreen() {
+    InstrumentedTarget menus(screen(), RenderPass::Menus);
     // Use default view coordinates (screen/UI space)
-    sf::Vector2u windowSize = window.getSize();
+    sf::Vector2u windowSize = screen().getSize();
 
     // Title: large centered "VICTORY"
-    sf::Text title;
-    title.setFont(font);
+    SdfText title;
+    title.setFont(titleFont);
     unsigned int titleSize = static_cast<unsigned int>(std::min(300.f, static_cast<float>(windowSize.y) * 0.15f));
     title.setCharacterSize(titleSize);
-    title.setStyle(sf::Text::Bold);
     title.setString("VICTORY");
     title.setFillColor(sf::Color(255,255,255,255));
     title.setOutlineColor(sf::Color(0,0,0,255));
@@ -919,7 +1065,7 @@ void Game::drawVictoryScreen() {
     sf::FloatRect tbTitle = title.getLocalBounds();
     title.setOrigin(tbTitle.left + tbTitle.width * 0.5f, tbTitle.top + tbTitle.height * 0.5f);
     title.setPosition(static_cast<float>(windowSize.x) * 0.5f, static_cast<float>(windowSize.y) * 0.34f);
-    window.draw(title);
+    menus.draw(title);
 
     // Label
     sf::Text exitText;
@@ -950,7 +1096,7 @@ void Game::drawVictoryScreen() {
     // hover zone so the user has an easier target when the text scales up.
     const float hoverScale = 1.06f;
     sf::Vector2i mousePixel = sf::Mouse::getPosition(window);
-    sf::Vector2f mouseUI = window.mapPixelToCoords(mousePixel, window.getDefaultView());
+    sf::Vector2f mouseUI = screen().mapPixelToCoords(mousePixel, screen().getDefaultView());
     float scaledW = tb.width * hoverScale;
     float scaledH = tb.height * hoverScale;
     sf::FloatRect hoverRect(pos.x - scaledW * 0.5f - padX, pos.y - scaledH * 0.5f - padY, scaledW + padX * 2.f, scaledH + padY * 2.f);
@@ -970,191 +1116,87 @@ void Game::drawVictoryScreen() {
     // Tint and scale the text when hovered (no box)
     exitText.setScale(finalScale, finalScale);
     exitText.setFillColor(hovered ? sf::Color::Yellow : sf::Color::White);
-    window.draw(exitText);
+    menus.draw(exitText);
 }
 
 void Game::render() {
-    window.clear();
-    window.setView(gameView);
-
-    if (!levelManager.isLevelTransitioning()) {
-        int currentLevel = levelManager.getCurrentLevel();
-        window.draw(getMapSprite(currentLevel));
-        // draw persistent ground decals (stains) under entities
-        Props::Explosion::renderGround(window);
-        
-        // Set interpolation alpha for player and zombies before they are rendered
-        player.setRenderAlpha(renderAlpha);
-        auto& zombies = levelManager.getZombies();
-        for (auto* z : zombies) {
-            z->setRenderAlpha(renderAlpha);
-        }
-
-        // Render the full level (tiles, zombies, props) so zombies are visible
-        levelManager.render(window);
+    // Per-pass CPU timings for the perf readout and the render benchmark
+    using clock = std::chrono::steady_clock;
+    const auto worldStart = clock::now();
+    passMs.fill(0.0);
 
-        // Draw spread cone under the player upper sprite (world-space)
-        // Skip drawing if player is dead
-        if (!player.isDead()) {
-            sf::Vector2i mousePixel = sf::Mouse::getPosition(window);
-            sf::Vector2f worldMouse = window.mapPixelToCoords(mousePixel, gameView);
-            float inaccuracyDeg = player.getCurrentSpreadDeg();
-            if (inaccuracyDeg > 0.0001f) {
-                float spreadRad = inaccuracyDeg * 3.14159265f / 180.0f;
-                float coneLen = 240.0f; // shorter cone
-                sf::Vector2f muzzlePos = player.getMuzzlePosition(worldMouse);
-                float baseDeg = player.getSprite().getRotation();
-                float baseRad = baseDeg * 3.14159265f / 180.0f;
-                sf::Vector2f leftP(muzzlePos.x + std::cos(baseRad - spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad - spreadRad) * coneLen);
-                sf::Vector2f rightP(muzzlePos.x + std::cos(baseRad + spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad + spreadRad) * coneLen);
-
-                sf::VertexArray fan(sf::TriangleFan);
-                sf::Color centerC(255,255,255,120);
-                sf::Color outerC(255,255,255,16);
-                fan.append(sf::Vertex(muzzlePos, centerC));
-                fan.append(sf::Vertex(leftP, outerC));
-                fan.append(sf::Vertex(rightP, outerC));
-                window.draw(fan);
-
-                sf::Vertex side1[2] = { sf::Vertex(muzzlePos, sf::Color(255,255,255,120)), sf::Vertex(leftP, sf::Color(255,255,255,80)) };
-                sf::Vertex side2[2] = { sf::Vertex(muzzlePos, sf::Color(255,255,255,120)), sf::Vertex(rightP, sf::Color(255,255,255,80)) };
-                window.draw(side1, 2, sf::Lines);
-                window.draw(side2, 2, sf::Lines);
-            }
-        }
+    screen().clear();
+    screen().setView(gameView);
+    viewCuller.begin(gameView, cullPadding);
 
+    const PostEffects post = computePostEffects();
+    bool postApplied = false;
+    if (!levelManager.isLevelTransitioning()) {
         // Sync player's debug origins flag with global debug toggle so muzzle markers follow backtick
         player.debugDrawOrigins = debugDrawHitboxes;
-        player.render(window);
-        // Now draw bullets so they appear over the player sprite
-        levelManager.renderBullets(window, bullets, renderAlpha);
-
-        // Draw reload prompt panel under the player if they are out of ammo and not currently reloading
-        if (player.getCurrentAmmo() <= 0 && !player.isReloading()) {
-            sf::Vector2f ppos = player.getPosition();
-            // Panel dimensions in world space
-            float panelW = 95.f;
-            float panelH = 28.f;
-            float yOffset = 54.f; // distance below player
-
-            sf::RectangleShape panel(sf::Vector2f(panelW, panelH));
-            panel.setOrigin(panelW * 0.5f, panelH * 0.5f);
-            panel.setPosition(ppos.x, ppos.y + yOffset);
-            // Use a more transparent background so it doesn't block the view
-            panel.setFillColor(sf::Color(0, 0, 0, 120));
-            // Softer outline
-            panel.setOutlineColor(sf::Color(255, 255, 255, 140));
-            panel.setOutlineThickness(1.5f);
-            window.draw(panel);
-
-            // Draw key icon on left (if available)
-            float iconPad = 8.f;
-            float iconH = panelH * 0.72f;
-            if (reloadKeyTexture.getSize().x > 0 && reloadKeySprite.getTexture() != nullptr) {
-                sf::Sprite ks = reloadKeySprite;
-                sf::Vector2u kts = reloadKeyTexture.getSize();
-                float scale = iconH / static_cast<float>(kts.y);
-                ks.setScale(scale, scale);
-                float iconX = ppos.x - panelW * 0.5f + iconPad;
-                float iconY = ppos.y + yOffset - panelH * 0.5f + (panelH - kts.y * scale) * 0.5f;
-                ks.setPosition(iconX, iconY);
-                window.draw(ks);
+
+        // The world covers the top-left worldScale fraction of its texture and is upscaled to the window
+        sf::View worldView = gameView;
+        worldView.setViewport(sf::FloatRect(0.f, 0.f, worldScale, worldScale));
+
+        if (renderThread.isRunning()) {
+            // Record the latest step for the render thread and show the world it finished last frame
+            submitWorld(renderThread.beginSnapshot(), 1.0f);
+            PlayerOverlay overlay = captureOverlay();
+            // The render thread moves the snapshot back by (1 - alpha) of each item's step motion
+            overlay.shift = -player.getMotion() * (1.0f - renderAlpha);
+            renderThread.publish(worldView);
+            const sf::Texture& world = renderThread.exchange(renderAlpha);
+            postApplied = compositeWorld(world, renderThread.getShownViewport(), post);
+
+            // Pieces that use font glyphs stay on this thread. They are drawn over the shown world from
+            // the state captured with its snapshot, so they stay on the player sprite.
+            screen().setView(gameView);
+            InstrumentedTarget overlays(screen(), RenderPass::World);
+            if (pendingOverlayValid) {
+                drawSpreadCone(overlays, pendingOverlay);
+                drawReloadPrompt(overlays, pendingOverlay);
+            }
+            pendingOverlay = overlay;
+            pendingOverlayValid = true;
+        } else {
+            submitWorld(renderQueue, renderAlpha);
+            pendingOverlayValid = false;
+
+            // Spread cone under the player upper sprite
+            const PlayerOverlay overlay = captureOverlay();
+            renderQueue.submitCommand(RenderLayer::SpreadCone, [this, overlay](InstrumentedTarget& target) { drawSpreadCone(target, overlay); });
+            renderQueue.submitCommand(RenderLayer::WorldPrompts, [this, overlay](InstrumentedTarget& target) { drawReloadPrompt(target, overlay); });
+
+            if (worldTextureReady) {
+                worldRenderTexture.clear();
+                worldRenderTexture.setView(worldView);
+                renderQueue.flush(worldRenderTexture);
+                worldRenderTexture.display();
+                postApplied = compositeWorld(worldRenderTexture.getTexture(), worldView.getViewport(), post);
             } else {
-                // fallback: draw a simple 'R' box
-                sf::RectangleShape keyBox(sf::Vector2f(iconH, iconH));
-                keyBox.setFillColor(sf::Color(30,30,30,140));
-                keyBox.setOutlineColor(sf::Color(255,255,255,140));
-                keyBox.setOutlineThickness(1.f);
-                float iconX = ppos.x - panelW * 0.5f + iconPad;
-                float iconY = ppos.y + yOffset - panelH * 0.5f + (panelH - iconH) * 0.5f;
-                keyBox.setPosition(iconX, iconY);
-                window.draw(keyBox);
-                sf::Text keyLetter;
-                keyLetter.setFont(font);
-                keyLetter.setCharacterSize(static_cast<unsigned int>(iconH * 0.6f));
-                keyLetter.setFillColor(sf::Color::White);
-                keyLetter.setString("R");
-                sf::FloatRect kb = keyLetter.getLocalBounds();
-                keyLetter.setPosition(iconX + (iconH - kb.width) * 0.5f - kb.left, iconY + (iconH - kb.height) * 0.5f - kb.top);
-                window.draw(keyLetter);
+                renderQueue.flush(screen());
             }
-
-            // Draw reload prompt text to the right of the icon
-            sf::Text reloadText;
-            if (font2.getInfo().family.empty()) reloadText.setFont(font);
-            else reloadText.setFont(font2);
-            reloadText.setCharacterSize(12);
-            reloadText.setFillColor(sf::Color::White);
-            reloadText.setOutlineColor(sf::Color::Black);
-            reloadText.setOutlineThickness(1.f);
-            reloadText.setString("RELOAD");
-            // compute text position
-            float textX = ppos.x - panelW * 0.5f + iconPad + iconH + 8.f;
-            float textY = ppos.y + yOffset - panelH * 0.5f + (panelH - reloadText.getLocalBounds().height) * 0.5f - reloadText.getLocalBounds().top;
-            reloadText.setPosition(textX, textY);
-            window.draw(reloadText);
         }
-
-        // Draw explosions and guts splatters (world-space) AFTER entities so airborne particles appear above zombies
-        // They use world coordinates, so keep the gameView when rendering them.
-        Props::Explosion::renderAll(window);
-        Guts::renderAll(window);
     }
 
-    // Draw world-space overlays (HUD/UI) using default view
-    window.setView(window.getDefaultView());
+    const auto hudStart = clock::now();
+    passMs[static_cast<size_t>(RenderPass::World)] = std::chrono::duration<double, std::milli>(hudStart - worldStart).count();
 
-    // Apply a simple grayscale overlay to desaturate the world (keeps UI and blood overlay unaffected).
-    float healthPercent = 1.0f;
-    if (player.getMaxHealth() > 0.0f) healthPercent = std::clamp(player.getCurrentHealth() / player.getMaxHealth(), 0.0f, 1.0f);
-    // non-linear ramp for desaturation (increase toward low health)
-    // Use desaturatePow to slow the ramp: t = (1 - health)^desaturatePow
-    float desatAmount = std::pow(1.0f - healthPercent, desaturatePow);
-    desatAmount = std::clamp(desatAmount, 0.0f, 1.0f);
-    if (desatAmount > 0.001f) {
-        // Reduce maximum strength so it never becomes too gray. Use a lighter base and lower max alpha.
-        const float MAX_ALPHA = 100.0f; // slightly lower for smoother ramp
-        sf::Uint8 a = static_cast<sf::Uint8>(std::clamp(desatAmount * MAX_ALPHA, 0.0f, MAX_ALPHA));
-        sf::RectangleShape desatRect(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
-        // Use a lighter gray so the effect is subtle
-        desatRect.setFillColor(sf::Color(180,180,180,a));
-        desatRect.setPosition(0.f, 0.f);
-        window.draw(desatRect);
-    }
-
-    // Draw blood overlay (screen-space) based on player's health (below UI)
-    if (bloodTexture.getSize().x > 0) {
-        float healthPercent = 1.0f;
-        if (player.getMaxHealth() > 0.0f) healthPercent = std::clamp(player.getCurrentHealth() / player.getMaxHealth(), 0.0f, 1.0f);
-        // intensity grows as health decreases.
-        float t = std::pow(1.0f - healthPercent, bloodIntensityPow);
-        t = std::clamp(t, 0.0f, 1.0f);
-        float alphaF = bloodMaxAlpha * t; // 0..bloodMaxAlpha
-        sf::Uint8 a = static_cast<sf::Uint8>(std::clamp(alphaF, 0.0f, 255.0f));
-        bloodSprite.setColor(sf::Color(255,255,255,a));
-        // scale sprite to cover current window size
-        sf::Vector2u ts = bloodTexture.getSize();
-        if (ts.x > 0 && ts.y > 0) {
-            float sx = static_cast<float>(window.getSize().x) / static_cast<float>(ts.x);
-            float sy = static_cast<float>(window.getSize().y) / static_cast<float>(ts.y);
-            bloodSprite.setScale(sx, sy);
-            bloodSprite.setPosition(0.f, 0.f);
-            window.draw(bloodSprite);
-        }
-    }
+    // Draw world-space overlays (HUD/UI) using default view
+    screen().setView(screen().getDefaultView());
+    InstrumentedTarget hud(screen(), RenderPass::Hud);
 
-    // Draw explosions and guts splatters (world-space) AFTER entities so airborne particles appear above zombies
-    // They use world coordinates, so keep the gameView when rendering them.
-    Props::Explosion::renderAll(window);
-    Guts::renderAll(window);
+    // Without the post-process shader the screen effects are separate overlays (UI stays unaffected)
+    if (!postApplied) drawPostOverlays(hud, post);
 
     // Draw zombie count in top-left corner
-    levelManager.renderUI(window, font);
-    levelManager.drawHUD(window, player);
+    levelManager.renderUI(screen(), font);
+    levelManager.drawHUD(screen(), player);
 
     if (levelManager.getCurrentState() == GameState::VICTORY) {
         // Ensure UI/default view is active
-        window.setView(window.getDefaultView());
+        screen().setView(screen().getDefaultView());
         drawVictoryScreen();
     }
 
@@ -1166,8 +1208,8 @@ void Game::render() {
         bool showOSCursor = levelManager.isLevelTransitioning() || st == GameState::GAME_OVER || st == GameState::VICTORY;
         window.setMouseCursorVisible(showOSCursor || paused);
 
-        // Draw custom mouse cursor only when OS cursor is hidden (gameplay)
-        if (!showOSCursor && !paused) {
+        // Draw custom mouse cursor only when OS cursor is hidden (gameplay; not in scripted runs)
+        if (!showOSCursor && !paused && !scripted) {
             sf::Vector2i mousePixel = sf::Mouse::getPosition(window);
             sf::CircleShape cursorDot(4.0f);
             cursorDot.setOrigin(4.0f, 4.0f);
@@ -1175,23 +1217,29 @@ void Game::render() {
             cursorDot.setFillColor(sf::Color::White);
             cursorDot.setOutlineColor(sf::Color::Black);
             cursorDot.setOutlineThickness(0.5f);
-            window.draw(cursorDot);
+            hud.draw(cursorDot);
         }
     }
 
+    if (showPerfOverlay) drawPerfOverlay();
+
+    const auto menusStart = clock::now();
+    passMs[static_cast<size_t>(RenderPass::Hud)] = std::chrono::duration<double, std::milli>(menusStart - hudStart).count();
+
+    InstrumentedTarget menus(screen(), RenderPass::Menus);
     // If paused, draw a transparent overlay with centered pause menu text entries
     if (paused) {
-        sf::RectangleShape overlay(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
+        sf::RectangleShape overlay(sf::Vector2f(static_cast<float>(screen().getSize().x), static_cast<float>(screen().getSize().y)));
         overlay.setFillColor(sf::Color(0, 0, 0, 140));
-        window.draw(overlay);
+        menus.draw(overlay);
 
         // Draw simple vertical text list: Resume, Controls, Settings, Exit (no button boxes)
         std::vector<std::string> labels = {"Resume", "Controls", "Settings", "Exit"};
         // Make font size scale with window height and clamp to a reasonable max
-        unsigned int fontSize = static_cast<unsigned int>(std::min(160.f, static_cast<float>(window.getSize().y) / 15.f));
+        unsigned int fontSize = static_cast<unsigned int>(std::min(160.f, static_cast<float>(screen().getSize().y) / 15.f));
         float spacing = static_cast<float>(fontSize) * 0.25f;
-        float centerX = static_cast<float>(window.getSize().x) * 0.5f;
-        float centerY = static_cast<float>(window.getSize().y) * 0.5f;
+        float centerX = static_cast<float>(screen().getSize().x) * 0.5f;
+        float centerY = static_cast<float>(screen().getSize().y) * 0.5f;
 
         // Measure total height using local bounds of a prototype text
         sf::Text proto;
@@ -1220,7 +1268,7 @@ void Game::render() {
 
         // Determine mouse position in default view coordinates
         sf::Vector2i mousePixel = sf::Mouse::getPosition(window);
-        sf::Vector2f mouseWorld = window.mapPixelToCoords(mousePixel, window.getDefaultView());
+        sf::Vector2f mouseWorld = screen().mapPixelToCoords(mousePixel, screen().getDefaultView());
 
         int hoveredIndex = -1;
         // Check which label is hovered by comparing mouse position with pre-computed hitboxes
@@ -1249,25 +1297,25 @@ void Game::render() {
             float tx = centerX - (tb.left + tb.width / 2.f);
             float ty = startY + static_cast<float>(i) * (lineH + spacing) + lineH * 0.5f - tb.top;
             t.setPosition(tx, ty);
-            window.draw(t);
+            menus.draw(t);
         }
     }
 
     // If paused and showingControls, draw the controls panel matching scene layout
     if (paused && showingControls) {
-        sf::Vector2f panelSize(window.getSize().x * 0.6f, window.getSize().y * 0.6f);
+        sf::Vector2f panelSize(screen().getSize().x * 0.6f, screen().getSize().y * 0.6f);
         sf::RectangleShape panel(panelSize);
         panel.setFillColor(sf::Color(20,20,20,255));
         panel.setOutlineColor(sf::Color::White);
         panel.setOutlineThickness(2.f);
         panel.setOrigin(panel.getSize().x/2.f, panel.getSize().y/2.f);
 
-        float titleBottom = static_cast<float>(window.getSize().y) / 5.0f; // approximate title area
+        float titleBottom = static_cast<float>(screen().getSize().y) / 5.0f; // approximate title area
         float gap = 20.f;
         const float PANEL_EXTRA_OFFSET = 80.f;
         float panelCenterY = titleBottom + gap + PANEL_EXTRA_OFFSET + panel.getSize().y / 2.f;
-        panel.setPosition(window.getSize().x/2.f, panelCenterY);
-        window.draw(panel);
+        panel.setPosition(screen().getSize().x/2.f, panelCenterY);
+        menus.draw(panel);
 
         sf::Text title;
         title.setFont(font); title.setCharacterSize(52); title.setFillColor(sf::Color::White);
@@ -1275,7 +1323,7 @@ void Game::render() {
         sf::FloatRect tbb = title.getLocalBounds();
         title.setOrigin(tbb.left + tbb.width/2.f, tbb.top + tbb.height/2.f);
         title.setPosition(panel.getPosition().x, panel.getPosition().y - panel.getSize().y/2.f + 40.f);
-        window.draw(title);
+        menus.draw(title);
 
         // Draw a short separator line below the title with fade to transparent at the edges (matches scene.cpp)
         {
@@ -1299,7 +1347,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerRight - centerLeft, sepThickness));
                 centerRect.setPosition(centerLeft, yTop);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                menus.draw(centerRect);
             }
 
             // left fading quad (two triangles)
@@ -1311,7 +1359,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(xL, yTop), colTransparent);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerLeft, yBottom), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(xL, yBottom), colTransparent);
-                window.draw(leftGrad);
+                menus.draw(leftGrad);
             }
 
             // right fading quad (two triangles)
@@ -1323,7 +1371,7 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerRight, yTop), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(xR, yBottom), colTransparent);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerRight, yBottom), colOpaque);
-                window.draw(rightGrad);
+                menus.draw(rightGrad);
             }
         }
 
@@ -1347,12 +1395,12 @@ void Game::render() {
         sf::Text leftHeader; leftHeader.setFont(font); leftHeader.setCharacterSize(36); leftHeader.setFillColor(sf::Color::White); leftHeader.setString("Movement");
         sf::FloatRect lh = leftHeader.getLocalBounds(); leftHeader.setOrigin(lh.left + lh.width/2.f, lh.top + lh.height/2.f);
         leftHeader.setPosition(leftColX + colWidth * 0.25f, headerY);
-        window.draw(leftHeader);
+        menus.draw(leftHeader);
 
         sf::Text rightHeader; rightHeader.setFont(font); rightHeader.setCharacterSize(36); rightHeader.setFillColor(sf::Color::White); rightHeader.setString("Combat");
         sf::FloatRect rh = rightHeader.getLocalBounds(); rightHeader.setOrigin(rh.left + rh.width/2.f, rh.top + rh.height/2.f);
         rightHeader.setPosition(rightColX + colWidth * 0.25f, headerY);
-        window.draw(rightHeader);
+        menus.draw(rightHeader);
 
         float startY = headerY + 24.f;
         // Shift content (bars, icons, vertical separators) downward between
@@ -1379,7 +1427,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerR - centerL, thickness));
                 centerRect.setPosition(centerL, y);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                menus.draw(centerRect);
             }
 
             // left fading quad (two triangles)
@@ -1391,7 +1439,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(xLeft, y), colTransparent);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerL, y + thickness), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(xLeft, y + thickness), colTransparent);
-                window.draw(leftGrad);
+                menus.draw(leftGrad);
             }
         };
 
@@ -1412,7 +1460,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(thickness, cyB - cyT));
                 centerRect.setPosition(x - thickness * 0.5f + 8.f, cyT);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                menus.draw(centerRect);
             }
             // bottom fade
             if (edgeFade >= 1.f) {
@@ -1425,7 +1473,7 @@ void Game::render() {
                 botGrad[3] = sf::Vertex(sf::Vector2f(x - thickness*0.5f + 8.f, cyB), colOpaque);
                 botGrad[4] = sf::Vertex(sf::Vector2f(x + thickness*0.5f + 8.f, yB), colTransparent);
                 botGrad[5] = sf::Vertex(sf::Vector2f(x - thickness*0.5f + 8.f, yB), colTransparent);
-                window.draw(botGrad);
+                menus.draw(botGrad);
             }
         };
 
@@ -1448,7 +1496,7 @@ void Game::render() {
             bar.setFillColor(sf::Color(36,36,36,220));
             bar.setOutlineColor(sf::Color(100,100,100,200));
             bar.setOutlineThickness(1.f);
-            window.draw(bar);
+            menus.draw(bar);
 
             // icon slot placeholder on left (draw icon if available)
             float slotH = barHeight - 12.f;
@@ -1466,10 +1514,10 @@ void Game::render() {
                 float spriteX = leftColX + 8.f + (iconSlotW - spriteW) * 0.5f;
                 float spriteY = y + 6.f + (slotH - tsize.y * scale) * 0.5f;
                 s.setPosition(spriteX, spriteY);
-                window.draw(s);
+                menus.draw(s);
             }
             else {
-                window.draw(iconSlot);
+                menus.draw(iconSlot);
             }
             // label (right-aligned within bar, leaving padding)
             label.setString(leftLabels[i]);
@@ -1478,7 +1526,7 @@ void Game::render() {
             float textX = leftColX + colWidth - textRightPadding - lb.width - lb.left;
             float textY = y + (barHeight - lb.height) / 2.f - lb.top;
             label.setPosition(textX, textY);
-            window.draw(label);
+            menus.draw(label);
         }
 
         for (size_t i = 0; i < rightLabels.size(); ++i) {
@@ -1489,7 +1537,7 @@ void Game::render() {
             bar.setFillColor(sf::Color(36,36,36,220));
             bar.setOutlineColor(sf::Color(100,100,100,200));
             bar.setOutlineThickness(1.f);
-            window.draw(bar);
+            menus.draw(bar);
 
 
             // icon slot placeholder on left of this bar (draw icon if available)
@@ -1509,9 +1557,9 @@ void Game::render() {
                 float spriteX = rightColX + 8.f + (iconSlotW - spriteW) * 0.5f;
                 float spriteY = y + 6.f + (slotH_R - tsize.y * scale) * 0.5f;
                 s.setPosition(spriteX, spriteY);
-                window.draw(s);
+                menus.draw(s);
             } else {
-                window.draw(iconSlotR);
+                menus.draw(iconSlotR);
             }
 
             // label (right-aligned within bar)
@@ -1521,7 +1569,7 @@ void Game::render() {
             float textX = rightColX + colWidth - textRightPadding - lb.width - lb.left;
             float textY = y + (barHeight - lb.height) / 2.f - lb.top;
             label.setPosition(textX, y + (barHeight - lb.height) / 2.f - lb.top);
-            window.draw(label);
+            menus.draw(label);
         }
 
         // Back button at bottom-right inside panel
@@ -1551,7 +1599,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerR - centerL, lineThickness));
                 centerRect.setPosition(centerL, lineY);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                menus.draw(centerRect);
             }
             // left fade
             if (centerL > lx_full + 1.f) {
@@ -1562,7 +1610,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(lx_full, lineY), colTransparentLocal);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerL, lineY + lineThickness), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(lx_full, lineY + lineThickness), colTransparentLocal);
-                window.draw(leftGrad);
+                menus.draw(leftGrad);
             }
             // right fade
             if (centerR < rx_full - 1.f) {
@@ -1573,13 +1621,13 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerR, lineY), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(rx_full, lineY + lineThickness), colTransparentLocal);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerR, lineY + lineThickness), colOpaque);
-                window.draw(rightGrad);
+                menus.draw(rightGrad);
             }
         }
 
         // detect hover over back button using default view coordinates
         sf::Vector2i mousePixelUI = sf::Mouse::getPosition(window);
-        sf::Vector2f mouseUI = window.mapPixelToCoords(mousePixelUI, window.getDefaultView());
+        sf::Vector2f mouseUI = screen().mapPixelToCoords(mousePixelUI, screen().getDefaultView());
         sf::FloatRect backRect(backPos.x, backPos.y, backWidth, backHeight);
         bool backHovered = backRect.contains(mouseUI);
         // play hover sound once when hovering begins
@@ -1593,7 +1641,7 @@ void Game::render() {
         backBorder.setOutlineThickness(2.f);
         backBorder.setOrigin(0.f, 0.f);
         backBorder.setPosition(backPos);
-        window.draw(backBorder);
+        menus.draw(backBorder);
 
         // Icon slot (left side of back button)
         float slotW = ICON_W;
@@ -1611,10 +1659,10 @@ void Game::render() {
             float spriteX = backPos.x + 8.f + (slotW - spriteW) * 0.5f;
             float spriteY = backPos.y + 6.f + (slotH - bts.y * scale) * 0.5f;
             backIconSprite.setPosition(spriteX, spriteY);
-            if (backHovered) { sf::Color prevCol = backIconSprite.getColor(); backIconSprite.setColor(sf::Color(255,255,180)); window.draw(backIconSprite); backIconSprite.setColor(prevCol); }
-            else window.draw(backIconSprite);
+            if (backHovered) { sf::Color prevCol = backIconSprite.getColor(); backIconSprite.setColor(sf::Color(255,255,180)); menus.draw(backIconSprite); backIconSprite.setColor(prevCol); }
+            else menus.draw(backIconSprite);
         } else {
-            window.draw(iconSlot);
+            menus.draw(iconSlot);
         }
 
         sf::Text backText; backText.setFont(font); backText.setCharacterSize(BACK_CHAR_SIZE); backText.setString("Back"); backText.setFillColor(backHovered ? sf::Color::Yellow : sf::Color::White);
@@ -1622,24 +1670,24 @@ void Game::render() {
         float tx = backPos.x + 8.f + ICON_W + ICON_PAD;
         float ty = backPos.y + (backHeight - tb.height) / 2.f - tb.top;
         backText.setPosition(tx, ty);
-        window.draw(backText);
+        menus.draw(backText);
     }
 
     // If paused and showingSettings, draw the settings panel (matches controls layout style)
     if (paused && showingSettings) {
-        sf::Vector2f panelSize(window.getSize().x * 0.6f, window.getSize().y * 0.6f);
+        sf::Vector2f panelSize(screen().getSize().x * 0.6f, screen().getSize().y * 0.6f);
         sf::RectangleShape panel(panelSize);
         panel.setFillColor(sf::Color(20, 20, 20, 255));
         panel.setOutlineColor(sf::Color::White);
         panel.setOutlineThickness(2.f);
         panel.setOrigin(panel.getSize().x / 2.f, panel.getSize().y / 2.f);
 
-        float titleBottom = static_cast<float>(window.getSize().y) / 5.0f; // approximate title area
+        float titleBottom = static_cast<float>(screen().getSize().y) / 5.0f; // approximate title area
         float gap = 20.f;
         const float PANEL_EXTRA_OFFSET = 80.f;
         float panelCenterY = titleBottom + gap + PANEL_EXTRA_OFFSET + panel.getSize().y / 2.f;
-        panel.setPosition(window.getSize().x / 2.f, panelCenterY);
-        window.draw(panel);
+        panel.setPosition(screen().getSize().x / 2.f, panelCenterY);
+        menus.draw(panel);
 
         sf::Text title;
         title.setFont(font); title.setCharacterSize(52); title.setFillColor(sf::Color::White);
@@ -1647,7 +1695,7 @@ void Game::render() {
         sf::FloatRect tbb = title.getLocalBounds();
         title.setOrigin(tbb.left + tbb.width / 2.f, tbb.top + tbb.height / 2.f);
         title.setPosition(panel.getPosition().x, panel.getPosition().y - panel.getSize().y / 2.f + 40.f);
-        window.draw(title);
+        menus.draw(title);
 
         // compute layout for sliders
         float sliderWidth = panelSize.x * 0.55f;
@@ -1672,7 +1720,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerRight - centerLeft, sepThickness));
                 centerRect.setPosition(centerLeft, sepY);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                menus.draw(centerRect);
             }
             if (centerLeft > xL + 1.f) {
                 sf::VertexArray leftGrad(sf::Triangles, 6);
@@ -1682,7 +1730,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(xL, sepY), colTransparent);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerLeft, sepY + sepThickness), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(xL, sepY + sepThickness), colTransparent);
-                window.draw(leftGrad);
+                menus.draw(leftGrad);
             }
             if (centerRight < xR - 1.f) {
                 sf::VertexArray rightGrad(sf::Triangles, 6);
@@ -1692,7 +1740,7 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerRight, sepY), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(xR, sepY + sepThickness), colTransparent);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerRight, sepY + sepThickness), colOpaque);
-                window.draw(rightGrad);
+                menus.draw(rightGrad);
             }
         }
 
@@ -1705,7 +1753,7 @@ void Game::render() {
             bg.setFillColor(sf::Color(60, 60, 60, 220));
             bg.setOutlineColor(sf::Color(120, 120, 120, 200));
             bg.setOutlineThickness(1.f);
-            window.draw(bg);
+            menus.draw(bg);
 
             // filled portion
             float fillW = sliderWidth * std::clamp(valuePct, 0.f, 1.f);
@@ -1713,7 +1761,7 @@ void Game::render() {
                 sf::RectangleShape fill(sf::Vector2f(fillW, barH));
                 fill.setPosition(sliderX, y - barH / 2.f);
                 fill.setFillColor(sf::Color(200, 200, 200, 220));
-                window.draw(fill);
+                menus.draw(fill);
             }
 
             // thumb
@@ -1725,13 +1773,13 @@ void Game::render() {
             thumb.setFillColor(sf::Color::White);
             thumb.setOutlineColor(sf::Color(40, 40, 40));
             thumb.setOutlineThickness(1.f);
-            window.draw(thumb);
+            menus.draw(thumb);
 
             // label on left of slider
             sf::Text lbl; lbl.setFont(font2); lbl.setCharacterSize(20); lbl.setFillColor(sf::Color::White); lbl.setString(labelStr);
             sf::FloatRect lb = lbl.getLocalBounds();
             lbl.setPosition(sliderX - lb.width - 16.f, y - lb.height / 2.f - lb.top);
-            window.draw(lbl);
+            menus.draw(lbl);
 
             // numeric percent on right of slider
             sf::Text pct; pct.setFont(font2); pct.setCharacterSize(18); pct.setFillColor(sf::Color::White);
@@ -1739,7 +1787,7 @@ void Game::render() {
             pct.setString(std::to_string(iv) + "%");
             sf::FloatRect pb = pct.getLocalBounds();
             pct.setPosition(sliderX + sliderWidth + 16.f, y - pb.height / 2.f - pb.top);
-            window.draw(pct);
+            menus.draw(pct);
             };
 
         // Rows: Master, Music, SFX
@@ -1757,7 +1805,7 @@ void Game::render() {
             box.setFillColor(sf::Color(30, 30, 30, 200));
             box.setOutlineThickness(1.f);
             box.setOutlineColor(sf::Color(120, 120, 120));
-            window.draw(box);
+            menus.draw(box);
             if (muted) {
                 // draw an X
                 sf::VertexArray vx(sf::Lines, 4);
@@ -1766,7 +1814,7 @@ void Game::render() {
                 vx[1] = sf::Vertex(sf::Vector2f(x + muteW - 4.f, y + 4.f), col);
                 vx[2] = sf::Vertex(sf::Vector2f(x + 4.f, y + 4.f), col);
                 vx[3] = sf::Vertex(sf::Vector2f(x + muteW - 4.f, y - 4.f), col);
-                window.draw(vx);
+                menus.draw(vx);
             }
             };
 
@@ -1800,7 +1848,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerR - centerL, lineThickness));
                 centerRect.setPosition(centerL, lineY);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                menus.draw(centerRect);
             }
             if (centerL > lx_full + 1.f) {
                 sf::VertexArray leftGrad(sf::Triangles, 6);
@@ -1810,7 +1858,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(lx_full, lineY), colTransparentLocal);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerL, lineY + lineThickness), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(lx_full, lineY + lineThickness), colTransparentLocal);
-                window.draw(leftGrad);
+                menus.draw(leftGrad);
             }
             if (centerR < rx_full - 1.f) {
                 sf::VertexArray rightGrad(sf::Triangles, 6);
@@ -1820,13 +1868,13 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerR, lineY), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(rx_full, lineY + lineThickness), colTransparentLocal);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerR, lineY + lineThickness), colOpaque);
-                window.draw(rightGrad);
+                menus.draw(rightGrad);
             }
         }
 
         // detect hover over back button
         sf::Vector2i mousePixelUI2 = sf::Mouse::getPosition(window);
-        sf::Vector2f mouseUI2 = window.mapPixelToCoords(mousePixelUI2, window.getDefaultView());
+        sf::Vector2f mouseUI2 = screen().mapPixelToCoords(mousePixelUI2, screen().getDefaultView());
         sf::FloatRect backRect2(backPos2.x, backPos2.y, backWidth2, backHeight2);
         bool backHovered2 = backRect2.contains(mouseUI2);
         if (backHovered2 && !lastBackHovered) { if (uiHoverSound.getBuffer()) uiHoverSound.play(); }
@@ -1838,7 +1886,7 @@ void Game::render() {
         backBorder2.setOutlineThickness(2.f);
         backBorder2.setOrigin(0.f, 0.f);
         backBorder2.setPosition(backPos2);
-        window.draw(backBorder2);
+        menus.draw(backBorder2);
 
         // icon slot
         float slotW2 = ICON_W;
@@ -1856,11 +1904,11 @@ void Game::render() {
             float spriteX = backPos2.x + 8.f + (slotW2 - spriteW) * 0.5f;
             float spriteY = backPos2.y + 6.f + (slotH2 - bts.y * scale) * 0.5f;
             backIconSprite.setPosition(spriteX, spriteY);
-            if (backHovered2) { sf::Color prevCol = backIconSprite.getColor(); backIconSprite.setColor(sf::Color(255, 255, 180)); window.draw(backIconSprite); backIconSprite.setColor(prevCol); }
-            else window.draw(backIconSprite);
+            if (backHovered2) { sf::Color prevCol = backIconSprite.getColor(); backIconSprite.setColor(sf::Color(255, 255, 180)); menus.draw(backIconSprite); backIconSprite.setColor(prevCol); }
+            else menus.draw(backIconSprite);
         }
         else {
-            window.draw(iconSlot2);
+            menus.draw(iconSlot2);
         }
 
         sf::Text backText2; backText2.setFont(font); backText2.setCharacterSize(BACK_CHAR_SIZE); backText2.setString("Back"); backText2.setFillColor(backHovered2 ? sf::Color::Yellow : sf::Color::White);
@@ -1868,17 +1916,16 @@ void Game::render() {
         float tx2 = backPos2.x + 8.f + ICON_W + ICON_PAD;
         float ty2 = backPos2.y + (backHeight2 - tb2.height) / 2.f - tb2.top;
         backText2.setPosition(tx2, ty2);
-        window.draw(backText2);
+        menus.draw(backText2);
     }
 
     // Draw GAME OVER text when triggered (fades in)
     if (gameOverTriggered && gameOverAlpha > 0.001f) {
-        sf::Text goText;
-        goText.setFont(font);
+        SdfText goText;
+        goText.setFont(titleFont);
         // Make size proportional to window height
-        unsigned int size = static_cast<unsigned int>(std::min(300.f, static_cast<float>(window.getSize().y) * 0.15f));
+        unsigned int size = static_cast<unsigned int>(std::min(300.f, static_cast<float>(screen().getSize().y) * 0.15f));
         goText.setCharacterSize(size);
-        goText.setStyle(sf::Text::Bold);
         goText.setString("GAME OVER");
         // fade alpha
         sf::Uint8 ia = static_cast<sf::Uint8>(std::clamp(gameOverAlpha * 255.0f, 0.0f, 255.0f));
@@ -1887,8 +1934,8 @@ void Game::render() {
         goText.setOutlineThickness(2.f);
         sf::FloatRect gb = goText.getLocalBounds();
         goText.setOrigin(gb.left + gb.width / 2.f, gb.top + gb.height / 2.f);
-        goText.setPosition(static_cast<float>(window.getSize().x) * 0.5f, static_cast<float>(window.getSize().y) * 0.30f);
-        window.draw(goText);
+        goText.setPosition(static_cast<float>(screen().getSize().x) * 0.5f, static_cast<float>(screen().getSize().y) * 0.30f);
+        menus.draw(goText);
 
         // Compute the title world rect (accounts for origin used above)
         sf::FloatRect titleWorldRect(
@@ -1911,25 +1958,25 @@ void Game::render() {
         sf::RectangleShape ulBack(ulSize + sf::Vector2f(6.f, 3.f));
         ulBack.setPosition(ulPos - sf::Vector2f(3.f, 1.5f));
         ulBack.setFillColor(sf::Color(0, 0, 0, ia));
-        window.draw(ulBack);
+        menus.draw(ulBack);
 
         // Foreground underline (white or hover-accent if you want)
         sf::RectangleShape underline(ulSize);
         underline.setPosition(ulPos);
         underline.setFillColor(sf::Color(255, 255, 255, ia));
-        window.draw(underline);
+        menus.draw(underline);
 
   
         // Draw two simple centered menu entries under the GAME OVER title
-        unsigned int itemSize = static_cast<unsigned int>(std::min(124.f, static_cast<float>(window.getSize().y) * 0.08f));
-        float startY = static_cast<float>(window.getSize().y) * 0.50f;
-        float lineSpacing = static_cast<float>(window.getSize().y) * 0.1f;
+        unsigned int itemSize = static_cast<unsigned int>(std::min(124.f, static_cast<float>(screen().getSize().y) * 0.08f));
+        float startY = static_cast<float>(screen().getSize().y) * 0.50f;
+        float lineSpacing = static_cast<float>(screen().getSize().y) * 0.1f;
         const std::vector<std::string> items = { "RETRY ROUND", "EXIT" };
         // Determine mouse UI position (default view)
         sf::Vector2i mousePixel = sf::Mouse::getPosition(window);
-        sf::Vector2f mouseUI = window.mapPixelToCoords(mousePixel, window.getDefaultView());
+        sf::Vector2f mouseUI = screen().mapPixelToCoords(mousePixel, screen().getDefaultView());
 
-        float centerX = static_cast<float>(window.getSize().x) * 0.5f;
+        float centerX = static_cast<float>(screen().getSize().x) * 0.5f;
         int hoveredIndex = -1;
 
         // Use same alpha as the GAME OVER title so menu fades consistently
@@ -1981,7 +2028,7 @@ void Game::render() {
             it.setOutlineThickness(outlineThickness);
             it.setFillColor(static_cast<int>(i) == hoveredIndex ? fillHover : fillNormal);
 
-            window.draw(it);
+            menus.draw(it);
         }
 
         // Update hover-tracking state used by hover-sound logic elsewhere
@@ -1994,22 +2041,25 @@ void Game::render() {
         }
     }
 
-    window.display();
+    passMs[static_cast<size_t>(RenderPass::Menus)] = std::chrono::duration<double, std::milli>(clock::now() - menusStart).count();
+
+    if (headless) offscreen.display();
+    else window.display();
 }
 
-sf::Sprite& Game::getMapSprite(int level) {
+ChunkedMap& Game::getMap(int level) {
     switch (level) {
         case 0:
         case 1:
         case 4:
         case 5:
-            return mapSprite1;
+            return map1;
         case 2:
-            return mapSprite2;
+            return map2;
         case 3:
-            return mapSprite3;
+            return map3;
         default:
-            return mapSprite1;
+            return map1;
     }
 }
 
@@ -2029,56 +2079,6 @@ sf::Vector2u Game::getMapSize(int level) {
     }
 }
 
-void Game::checkZombiePlayerCollisions() {
-    auto& zombiesRef = levelManager.getZombies();
-    for (auto it = zombiesRef.begin(); it != zombiesRef.end(); ) {
-        BaseZombie* zb = *it;
-
-        sf::FloatRect playerHitbox = player.getHitbox();
-
-        // Use oriented OB box for attack -> accurate direction-dependent collision
-        sf::Vector2f attackCenter, attackHalf; float attackRot;
-        zb->getAttackOBB(attackCenter, attackHalf, attackRot);
-        bool pzCollision = obbIntersectsAabb(attackCenter, attackHalf, attackRot, playerHitbox);
-        if (pzCollision && zb->isAttacking()) {
-            float damageToApply = zb->tryDealDamage();
-            if (damageToApply > 0) {
-                player.takeDamage(damageToApply);
-                // play via pooled sounds to allow overlap
-                playZombieBite();
-
-                sf::Vector2f direction = player.getPosition() - zb->getPosition();
-                float magnitude = sqrt(direction.x * direction.x + direction.y * direction.y);
-                if (magnitude > 0) {
-                    direction.x /= magnitude;
-                    direction.y /= magnitude;
-                    player.applyKnockback(direction, 50.0f);
-                }
-            }
-        }
-        
-        if (player.isAttacking()) {
-            sf::FloatRect playerAttackBox = player.getAttackHitbox();
-            sf::FloatRect zombieBodyHitbox = zb->getHitbox();
-            if (isCollision(playerAttackBox, zombieBodyHitbox)) {
-                zb->takeDamage(player.getAttackDamage());
-                if (!zb->isAlive()) {
-                    // Award points and track progression. Do NOT erase the zombie pointer here;
-                    // LevelManager will remove the entity and unregister the physics body on its update.
-                    points += 10;
-                    zombiesToNextLevel--;
-                    if (zombiesToNextLevel <= 0) {
-                        levelManager.nextLevel();
-                        int currentLevel = levelManager.getCurrentLevel();
-                        zombiesToNextLevel = 15;
-                    }
-                }
-            }
-        }
-        ++it;
-    }
-}
-
 void Game::checkPlayerBoundaries() {
     sf::Vector2f playerPos = player.getPosition();
     int currentLevel = levelManager.getCurrentLevel();
@@ -2103,41 +2103,6 @@ bool Game::isCollision(const sf::FloatRect& rect1, const sf::FloatRect& rect2) {
     return rect1.intersects(rect2);
 }
 
-// SAT-based OBB vs AABB test: OBB given by center, half-extents, rotation degrees; AABB given by rect
-static bool obbIntersectsAabb(const sf::Vector2f& c, const sf::Vector2f& he, float rotDeg, const sf::FloatRect& aabb) {
-    // Build OBB axes
-    float rad = rotDeg * 3.14159265f / 180.0f;
-    sf::Vector2f ux(std::cos(rad), std::sin(rad));
-    sf::Vector2f uy(-ux.y, ux.x);
-
-    // AABB center
-    sf::Vector2f ac(aabb.left + aabb.width * 0.5f, aabb.top + aabb.height * 0.5f);
-    sf::Vector2f t = ac - c;
-
-    // Projected radii on axes
-    float ra, rb;
-
-    // test axis ux
-    ra = he.x;
-    rb = std::abs(aabb.width * 0.5f * ux.x) + std::abs(aabb.height * 0.5f * ux.y);
-    if (std::abs(t.x * ux.x + t.y * ux.y) > ra + rb) return false;
-
-    // test axis uy
-    ra = he.y;
-    rb = std::abs(aabb.width * 0.5f * uy.x) + std::abs(aabb.height * 0.5f * uy.y);
-    if (std::abs(t.x * uy.x + t.y * uy.y) > ra + rb) return false;
-
-    // test AABB axes x and y
-    // project OBB onto world X
-    float obbPx = std::abs(ux.x * he.x) + std::abs(uy.x * he.y);
-    if (std::abs(t.x) > obbPx + aabb.width * 0.5f) return false;
-    // project OBB onto world Y
-    float obbPy = std::abs(ux.y * he.x) + std::abs(uy.y * he.y);
-    if (std::abs(t.y) > obbPy + aabb.height * 0.5f) return false;
-
-    return true;
-}
-
 void Game::addPoints(int amount) {
     points += amount;
 }
@@ -2177,6 +2142,459 @@ void Game::reset() {
      shootRequested = false;
 }
 
+void Game::startHorde(int maxActive) {
+    if (maxActive > 0) {
+        LevelManager::HordeConfig cfg = levelManager.getHordeConfig();
+        cfg.maxActive = maxActive;
+        levelManager.setHordeConfig(cfg);
+    }
+    levelManager.startHorde(player.getPosition());
+    showPerfOverlay = true;
+}
+
+bool Game::runBenchmark(const BenchmarkOptions& options) {
+    using clock = std::chrono::steady_clock;
+    const float PHYS_STEP = 1.0f / 120.0f;
+    const int stepsPerFrame = 2; // 60 fps
+
+    std::srand(options.seed);
+    GameRandom::seed(options.seed);
+    startHorde(options.hordeMax);
+    // Keep frames comparable between runs: no live readout, no dynamic resolution, no input
+    showPerfOverlay = false;
+    worldScale = maxWorldScale;
+    scripted = true;
+    // A dead player would leave every later frame on the game-over screen
+    player.setInvulnerable(true);
+    player.setKeyboardEnabled(false);
+
+    if (renderThreadEnabled && !renderThread.start(screen().getSize())) {
+        std::cerr << "Render thread unavailable, rendering on the main thread" << std::endl;
+        renderThreadEnabled = false;
+    }
+
+    const size_t passCount = static_cast<size_t>(RenderPass::Count);
+    std::vector<double> frameMs;
+    std::vector<std::array<double, static_cast<size_t>(RenderPass::Count)>> passSamples;
+    std::array<RenderStats::Averages, static_cast<size_t>(RenderPass::Count)> drawTotals{}; // sums
+    const int measured = std::max(0, options.frames - options.warmupFrames);
+    frameMs.reserve(measured);
+    passSamples.reserve(measured);
+
+    // The player walks a circle around the start point, aiming outwards and firing every few frames
+    const sf::Vector2f center = player.getPosition();
+    const float radius = 300.0f;
+    bool ok = true;
+    for (int frame = 0; frame < options.frames; ++frame) {
+        if (window.isOpen()) {
+            sf::Event event;
+            while (window.pollEvent(event)) {}
+        }
+
+        if (player.isDead()) {
+            std::cerr << "[Benchmark] player died at frame " << frame << ", run is not comparable" << std::endl;
+            renderThread.stop();
+            scripted = false;
+            player.setInvulnerable(false);
+            player.setKeyboardEnabled(true);
+            return false;
+        }
+
+        const float angle = frame * 0.01f;
+        const sf::Vector2f dir(std::cos(angle), std::sin(angle));
+        player.getBody().position = Vec2(center.x + dir.x * radius, center.y + dir.y * radius);
+        scriptedAim = center + dir * (radius + 400.0f);
+        if (player.getCurrentAmmo() <= 0 && !player.isReloading()) player.startReload();
+        if (frame % 8 == 0) {
+            shootRequested = true;
+            shootTarget = scriptedAim;
+        }
+        for (int i = 0; i < stepsPerFrame; ++i) update(PHYS_STEP);
+        // halfway between two steps, so interpolation is exercised
+        renderAlpha = 0.5f;
+
+        auto r0 = clock::now();
+        render();
+        auto r1 = clock::now();
+        RenderStats::instance().endFrame();
+
+        if (frame >= options.warmupFrames) {
+            frameMs.push_back(std::chrono::duration<double, std::milli>(r1 - r0).count());
+            passSamples.push_back(passMs);
+            for (size_t p = 0; p < passCount; ++p) {
+                const DrawCounters& c = RenderStats::instance().getFrame(static_cast<RenderPass>(p));
+                drawTotals[p].draws += c.draws;
+                drawTotals[p].vertices += c.vertices;
+                drawTotals[p].textureChanges += c.textureChanges;
+                drawTotals[p].blendChanges += c.blendChanges;
+            }
+        }
+
+        if (options.goldenEvery > 0 && frame % options.goldenEvery == 0) {
+            std::ostringstream path;
+            path << options.goldenDir << "/frame_" << std::setw(5) << std::setfill('0') << frame << ".png";
+            if (!saveScreenshot(path.str())) ok = false;
+        }
+    }
+    renderThread.stop();
+    scripted = false;
+    player.setInvulnerable(false);
+    player.setKeyboardEnabled(true);
+
+    if (frameMs.empty()) {
+        std::cerr << "[Benchmark] no measured frames (frames <= warmup)" << std::endl;
+        return false;
+    }
+
+    // Mean and 95th percentile of a sample set
+    auto summarize = [](std::vector<double> v, double& mean, double& p95) {
+        double sum = 0.0;
+        for (double x : v) sum += x;
+        mean = sum / v.size();
+        std::sort(v.begin(), v.end());
+        p95 = v[std::min(v.size() - 1, static_cast<size_t>(v.size() * 0.95))];
+    };
+
+    const sf::Vector2u size = screen().getSize();
+    const double n = static_cast<double>(frameMs.size());
+    std::cout << "[Benchmark] " << frameMs.size() << " frames (+" << options.warmupFrames << " warmup) at "
+              << size.x << "x" << size.y << (headless ? " offscreen" : " windowed")
+              << ", render thread " << (renderThreadEnabled ? "on" : "off")
+              << ", active zombies " << levelManager.getActiveZombieCount() << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (size_t p = 0; p < passCount; ++p) {
+        std::vector<double> samples;
+        samples.reserve(passSamples.size());
+        for (const auto& s : passSamples) samples.push_back(s[p]);
+        double mean = 0.0, p95 = 0.0;
+        summarize(samples, mean, p95);
+        const RenderStats::Averages& t = drawTotals[p];
+        if (mean <= 0.0 && t.draws == 0.0) continue;
+        std::cout << "[Benchmark] " << RenderStats::getName(static_cast<RenderPass>(p))
+                  << " avg " << mean << " ms, p95 " << p95 << " ms"
+                  << ", draws " << std::setprecision(1) << t.draws / n
+                  << ", verts " << t.vertices / n
+                  << ", tex " << t.textureChanges / n
+                  << ", blend " << t.blendChanges / n << std::setprecision(3) << std::endl;
+    }
+    double mean = 0.0, p95 = 0.0;
+    summarize(frameMs, mean, p95);
+    std::cout << "[Benchmark] render avg " << mean << " ms, p95 " << p95 << " ms" << std::endl;
+    std::cout.unsetf(std::ios::floatfield);
+    return ok;
+}
+
+bool Game::saveScreenshot(const std::string& path) {
+    sf::Image image;
+    if (headless) {
+        image = offscreen.getTexture().copyToImage();
+    } else {
+        sf::Texture capture;
+        if (!capture.create(window.getSize().x, window.getSize().y)) return false;
+        capture.update(window);
+        image = capture.copyToImage();
+    }
+    if (!image.saveToFile(path)) {
+        std::cerr << "Failed to save " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// World-space systems submit into the queue; RenderLayer decides the draw order. Everything submitted
+// here is plain quads or self-contained commands, so the queue can also be a render-thread snapshot.
+void Game::submitWorld(RenderQueue& queue, float alpha) {
+    // Render positions of the player, zombies and bullets, all in one pass
+    TransformBuffer::instance().interpolate(alpha);
+
+    // Only the map chunks under the camera are submitted
+    getMap(levelManager.getCurrentLevel()).submit(queue, gameView);
+    // persistent ground decals (stains) under entities
+    Props::Explosion::renderGround(queue, gameView);
+
+    // The player's shadow joins the zombies' single shadow draw
+    player.drawShadow(levelManager.getShadowBarRenderer());
+    levelManager.render(queue, viewCuller);
+
+    player.render(queue);
+    // Bullets appear over the player sprite (see RenderLayer)
+    levelManager.renderBullets(queue, bullets, viewCuller);
+    levelManager.renderEnemyProjectiles(queue, alpha);
+
+    // Explosions and guts splatters AFTER entities so airborne particles appear above zombies
+    Props::Explosion::renderAll(queue, viewCuller);
+    Guts::renderAll(queue, viewCuller);
+
+    // Debug builds: everything reported this frame (including the culler's accepted bounds above)
+    // goes out as one line list over the world
+    if (DebugDraw::isEnabled()) {
+        physics.reportDebugShapes();
+        combat.reportDebugShapes();
+        viewCuller.reportDebugShapes();
+        for (auto* z : levelManager.getZombies()) DebugDraw::rect(z->getHitbox(), sf::Color(255, 140, 0));
+        if (player.debugDrawOrigins) player.reportDebugShapes();
+        DebugDraw::submit(queue);
+    }
+}
+
+Game::PostEffects Game::computePostEffects() {
+    PostEffects post;
+    float healthPercent = 1.0f;
+    if (player.getMaxHealth() > 0.0f) healthPercent = std::clamp(player.getCurrentHealth() / player.getMaxHealth(), 0.0f, 1.0f);
+    // non-linear ramps toward low health; desaturatePow slows the desaturation for mid-health values
+    post.desaturate = std::clamp(std::pow(1.0f - healthPercent, desaturatePow), 0.0f, 1.0f);
+    if (bloodTexture.getSize().x > 0) {
+        float t = std::clamp(std::pow(1.0f - healthPercent, bloodIntensityPow), 0.0f, 1.0f);
+        post.blood = std::clamp(bloodMaxAlpha * t, 0.0f, 255.0f) / 255.0f;
+    }
+    if (gameOverTriggered) post.fade = std::clamp(gameOverAlpha, 0.0f, 1.0f) * gameOverDimMax;
+    return post;
+}
+
+// Upscale the rendered part (viewport) of a world texture to the whole window, applying the screen
+// effects in the same pass
+bool Game::compositeWorld(const sf::Texture& texture, const sf::FloatRect& viewport, const PostEffects& post) {
+    const sf::Vector2u ts = texture.getSize();
+    const int w = std::max(1, static_cast<int>(std::round(ts.x * viewport.width)));
+    const int h = std::max(1, static_cast<int>(std::round(ts.y * viewport.height)));
+    sf::Sprite world(texture, sf::IntRect(0, 0, w, h));
+    world.setScale(static_cast<float>(screen().getSize().x) / w, static_cast<float>(screen().getSize().y) / h);
+    screen().setView(screen().getDefaultView());
+    InstrumentedTarget out(screen(), RenderPass::World);
+    if (!postShaderLoaded) {
+        out.draw(world);
+        return false;
+    }
+    postShader.setUniform("u_screenSize", sf::Vector2f(static_cast<float>(screen().getSize().x), static_cast<float>(screen().getSize().y)));
+    postShader.setUniform("u_desat", post.desaturate * desaturateMax);
+    postShader.setUniform("u_blood", post.blood);
+    postShader.setUniform("u_fade", post.fade);
+    out.draw(world, sf::RenderStates(&postShader));
+    return true;
+}
+
+// Fallback for the screen effects: one fullscreen blend per effect
+void Game::drawPostOverlays(InstrumentedTarget& target, const PostEffects& post) {
+    const sf::Vector2f screenSize(static_cast<float>(screen().getSize().x), static_cast<float>(screen().getSize().y));
+    if (post.desaturate > 0.001f) {
+        // A light gray wash at reduced strength so it never becomes too gray
+        const float MAX_ALPHA = 100.0f;
+        sf::RectangleShape desatRect(screenSize);
+        desatRect.setFillColor(sf::Color(180, 180, 180, static_cast<sf::Uint8>(post.desaturate * MAX_ALPHA)));
+        target.draw(desatRect);
+    }
+    if (post.blood > 0.001f) {
+        // scale the overlay to cover the current window size
+        sf::Vector2u ts = bloodTexture.getSize();
+        bloodSprite.setColor(sf::Color(255, 255, 255, static_cast<sf::Uint8>(post.blood * 255.0f)));
+        bloodSprite.setScale(screenSize.x / static_cast<float>(ts.x), screenSize.y / static_cast<float>(ts.y));
+        bloodSprite.setPosition(0.f, 0.f);
+        target.draw(bloodSprite);
+    }
+    if (post.fade > 0.001f) {
+        sf::RectangleShape fadeRect(screenSize);
+        fadeRect.setFillColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(post.fade * 255.0f)));
+        target.draw(fadeRect);
+    }
+}
+
+// Dynamic resolution: drop the world scale quickly when the smoothed frame time is over budget and
+// raise it slowly while frames fit (the frame limiter keeps them at the budget when there is headroom)
+void Game::updateWorldScale(float deltaTime) {
+    if (!worldTextureReady && !renderThread.isRunning()) return;
+    worldScaleHold += deltaTime;
+    float next = worldScale;
+    if (smoothedTimings.frame > frameBudgetMs * 1.1 && worldScaleHold >= 0.25f) next -= worldScaleStep;
+    else if (smoothedTimings.frame < frameBudgetMs * 1.03 && worldScaleHold >= 2.0f) next += worldScaleStep;
+    next = std::clamp(next, minWorldScale, maxWorldScale);
+    if (next != worldScale) {
+        worldScale = next;
+        worldScaleHold = 0.0f;
+    }
+}
+
+// Aim spread cone from the muzzle and reload prompt position, in world space
+Game::PlayerOverlay Game::captureOverlay() {
+    PlayerOverlay overlay;
+    // Skip drawing if player is dead
+    if (player.isDead()) return overlay;
+
+    float inaccuracyDeg = player.getCurrentSpreadDeg();
+    if (inaccuracyDeg > 0.0001f) {
+        sf::Vector2f worldMouse = getWorldMousePosition();
+        float spreadRad = inaccuracyDeg * 3.14159265f / 180.0f;
+        float coneLen = 240.0f; // shorter cone
+        sf::Vector2f muzzlePos = player.getMuzzlePosition(worldMouse);
+        float baseDeg = player.getSprite().getRotation();
+        float baseRad = baseDeg * 3.14159265f / 180.0f;
+        sf::Vector2f leftP(muzzlePos.x + std::cos(baseRad - spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad - spreadRad) * coneLen);
+        sf::Vector2f rightP(muzzlePos.x + std::cos(baseRad + spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad + spreadRad) * coneLen);
+
+        sf::Color centerC(255,255,255,120);
+        sf::Color outerC(255,255,255,16);
+        overlay.coneFan[0] = sf::Vertex(muzzlePos, centerC);
+        overlay.coneFan[1] = sf::Vertex(leftP, outerC);
+        overlay.coneFan[2] = sf::Vertex(rightP, outerC);
+        overlay.coneSides[0] = sf::Vertex(muzzlePos, sf::Color(255,255,255,120));
+        overlay.coneSides[1] = sf::Vertex(leftP, sf::Color(255,255,255,80));
+        overlay.coneSides[2] = sf::Vertex(muzzlePos, sf::Color(255,255,255,120));
+        overlay.coneSides[3] = sf::Vertex(rightP, sf::Color(255,255,255,80));
+        overlay.cone = true;
+    }
+
+    // Out of ammo and not currently reloading
+    if (player.getCurrentAmmo() <= 0 && !player.isReloading()) {
+        overlay.reloadPrompt = true;
+        overlay.promptPosition = player.getPosition();
+    }
+    return overlay;
+}
+
+void Game::drawSpreadCone(InstrumentedTarget& target, const PlayerOverlay& overlay) {
+    if (!overlay.cone) return;
+    sf::RenderStates states;
+    states.transform.translate(overlay.shift);
+    target.draw(overlay.coneFan, 3, sf::TriangleFan, states);
+    target.draw(overlay.coneSides, 4, sf::Lines, states);
+}
+
+// Reload prompt panel under the player if they are out of ammo and not currently reloading (world-space)
+// Built once around the prompt's centre; drawReloadPrompt only translates it under the player
+void Game::buildReloadPrompt() {
+    // Panel dimensions in world space
+    const float panelW = 95.f;
+    const float panelH = 28.f;
+    reloadPromptPanel.setSize(sf::Vector2f(panelW, panelH));
+    reloadPromptPanel.setOrigin(panelW * 0.5f, panelH * 0.5f);
+    // Use a more transparent background so it doesn't block the view
+    reloadPromptPanel.setFillColor(sf::Color(0, 0, 0, 120));
+    // Softer outline
+    reloadPromptPanel.setOutlineColor(sf::Color(255, 255, 255, 140));
+    reloadPromptPanel.setOutlineThickness(1.5f);
+
+    // Key icon on the left (if available)
+    const float iconPad = 8.f;
+    const float iconH = panelH * 0.72f;
+    const float iconX = -panelW * 0.5f + iconPad;
+    reloadPromptHasIcon = reloadKeyTexture.getSize().x > 0 && reloadKeySprite.getTexture() != nullptr;
+    if (reloadPromptHasIcon) {
+        reloadPromptKey = reloadKeySprite;
+        sf::Vector2u kts = reloadKeyTexture.getSize();
+        float scale = iconH / static_cast<float>(kts.y);
+        reloadPromptKey.setScale(scale, scale);
+        reloadPromptKey.setPosition(iconX, -panelH * 0.5f + (panelH - kts.y * scale) * 0.5f);
+    } else {
+        // fallback: a simple 'R' box
+        const float iconY = -panelH * 0.5f + (panelH - iconH) * 0.5f;
+        reloadPromptKeyBox.setSize(sf::Vector2f(iconH, iconH));
+        reloadPromptKeyBox.setFillColor(sf::Color(30,30,30,140));
+        reloadPromptKeyBox.setOutlineColor(sf::Color(255,255,255,140));
+        reloadPromptKeyBox.setOutlineThickness(1.f);
+        reloadPromptKeyBox.setPosition(iconX, iconY);
+        reloadPromptKeyLetter.setFont(font);
+        reloadPromptKeyLetter.setCharacterSize(static_cast<unsigned int>(iconH * 0.6f));
+        reloadPromptKeyLetter.setFillColor(sf::Color::White);
+        reloadPromptKeyLetter.setString("R");
+        sf::FloatRect kb = reloadPromptKeyLetter.getLocalBounds();
+        reloadPromptKeyLetter.setPosition(iconX + (iconH - kb.width) * 0.5f - kb.left, iconY + (iconH - kb.height) * 0.5f - kb.top);
+    }
+
+    // Reload prompt text to the right of the icon
+    if (font2.getInfo().family.empty()) reloadPromptText.setFont(font);
+    else reloadPromptText.setFont(font2);
+    reloadPromptText.setCharacterSize(12);
+    reloadPromptText.setFillColor(sf::Color::White);
+    reloadPromptText.setOutlineColor(sf::Color::Black);
+    reloadPromptText.setOutlineThickness(1.f);
+    reloadPromptText.setString("RELOAD");
+    sf::FloatRect tb = reloadPromptText.getLocalBounds();
+    reloadPromptText.setPosition(iconX + iconH + 8.f, -panelH * 0.5f + (panelH - tb.height) * 0.5f - tb.top);
+    reloadPromptBuilt = true;
+}
+
+void Game::drawReloadPrompt(InstrumentedTarget& target, const PlayerOverlay& overlay) {
+    if (overlay.reloadPrompt) {
+        if (!reloadPromptBuilt) buildReloadPrompt();
+        const float yOffset = 54.f; // distance below player
+        sf::Vector2f ppos = overlay.promptPosition + overlay.shift;
+        sf::RenderStates states;
+        states.transform.translate(ppos.x, ppos.y + yOffset);
+        target.draw(reloadPromptPanel, states);
+        if (reloadPromptHasIcon) {
+            target.draw(reloadPromptKey, states);
+        } else {
+            target.draw(reloadPromptKeyBox, states);
+            target.draw(reloadPromptKeyLetter, states);
+        }
+        target.draw(reloadPromptText, states);
+    }
+}
+
+void Game::drawPerfOverlay() {
+    screen().setView(screen().getDefaultView());
+    InstrumentedTarget hud(screen(), RenderPass::Hud);
+
+    double fps = (smoothedTimings.frame > 0.0) ? 1000.0 / smoothedTimings.frame : 0.0;
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2)
+       << "frame   " << smoothedTimings.frame << " ms (" << std::setprecision(0) << fps << " fps)\n" << std::setprecision(2)
+       << "physics " << smoothedTimings.physics << " ms\n"
+       << "ai      " << smoothedTimings.ai << " ms\n"
+       << "reorder " << smoothedTimings.reorder << " ms (morton " << (levelManager.isMortonOrderingEnabled() ? "on" : "off") << ", F4)\n"
+       << "level   " << smoothedTimings.level << " ms\n"
+       << "render  " << smoothedTimings.render << " ms\n"
+       << "zombies " << levelManager.getActiveZombieCount() << " active / " << levelManager.getQueuedZombieCount()
+       << " queued / " << levelManager.getPooledZombieCount() << " pooled\n"
+       << "bodies  " << physics.getDynamicBodyCount() << " dynamic / " << physics.getStaticBodyCount()
+       << " static, " << physics.getLastCollisionChecks() << " checks\n"
+       << "drawn/culled";
+    for (auto c : { ViewCuller::Category::Zombies, ViewCuller::Category::Bullets, ViewCuller::Category::Explosions, ViewCuller::Category::Guts }) {
+        ss << " " << ViewCuller::getName(c) << " " << viewCuller.getDrawn(c) << "/" << viewCuller.getCulled(c);
+    }
+    if (renderThread.isRunning()) ss << "\nqueue   " << renderThread.getLastItemCount() << " items, " << renderThread.getLastDrawCalls() << " draws (render thread)";
+    else ss << "\nqueue   " << renderQueue.getLastItemCount() << " items, " << renderQueue.getLastDrawCalls() << " draws";
+    // Draw counters per pass: last frame, with the rolling average of draws
+    for (size_t i = 0; i < static_cast<size_t>(RenderPass::Count); ++i) {
+        const RenderPass pass = static_cast<RenderPass>(i);
+        const DrawCounters& f = RenderStats::instance().getFrame(pass);
+        const RenderStats::Averages& a = RenderStats::instance().getAverage(pass);
+        if (f.draws == 0 && a.draws < 0.5) continue;
+        std::string name = RenderStats::getName(pass);
+        name.resize(8, ' ');
+        ss << "\n" << name << f.draws << " draws (avg " << std::setprecision(1) << a.draws << std::setprecision(2) << "), "
+           << f.vertices << " verts, " << f.textureChanges << " tex, " << f.blendChanges << " blend";
+    }
+    const ChunkedMap& map = getMap(levelManager.getCurrentLevel());
+    ss << "\nmap     " << map.getLastVisibleCount() << "/" << map.getChunkCount() << " chunks";
+    ss << "\nres     " << std::setprecision(0) << worldScale * 100.f << "% ("
+       << static_cast<int>(screen().getSize().x * worldScale) << "x" << static_cast<int>(screen().getSize().y * worldScale) << ")" << std::setprecision(2);
+    if (levelManager.getCurrentState() == GameState::HORDE) {
+        ss << "\nhorde   target " << levelManager.getHordeTargetCount() << " at "
+           << std::setprecision(0) << levelManager.getHordeElapsed() << " s";
+    }
+    perfText.setString(ss.str());
+
+    // Below the zombie counter in the top-left, on a dark backing for readability
+    sf::FloatRect tb = perfText.getLocalBounds();
+    const float x = 12.f, y = 70.f, pad = 6.f;
+    sf::RectangleShape backing(sf::Vector2f(tb.left + tb.width + pad * 2.f, tb.top + tb.height + pad * 2.f));
+    backing.setPosition(x - pad, y - pad);
+    backing.setFillColor(sf::Color(0, 0, 0, 150));
+    hud.draw(backing);
+    perfText.setPosition(x, y);
+    hud.draw(perfText);
+}
+
+sf::RenderTarget& Game::screen() {
+    if (headless) return offscreen;
+    return window;
+}
+
+sf::Vector2f Game::getWorldMousePosition() {
+    if (scripted) return scriptedAim;
+    return screen().mapPixelToCoords(sf::Mouse::getPosition(window), gameView);
+}
+
 sf::RenderWindow& Game::getWindow() {
     return window;
 }
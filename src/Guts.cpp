@@ -1,4 +1,7 @@
 #include "Guts.h" // adjust path if you placed header elsewhere
+#include "RenderQueue.h"
+#include "ViewCuller.h"
+#include <algorithm>
 #include <random>
 #include <cmath>
 
@@ -16,8 +19,6 @@ Guts::Guts(const Vec2& pos, const Vec2& v)
       _initialVelocity(v), _isDone(false), _duration(20.0f)
 {
     body.isCircle = true;
-    body.getCircleShape().setRadius(3.f);
-    body.getCircleShape().setOrigin(3.f, 3.f);
     body.position = pos;
 
     // create simple particle cloud
@@ -82,18 +83,22 @@ void Guts::update(float dt) {
     }
 }
 
-void Guts::render(sf::RenderWindow& window) {
+void Guts::render(RenderQueue& queue) {
     for (size_t i = 0; i < _particlesPos.size(); ++i) {
         if (_texture.getSize().x > 0) {
             _sprite.setPosition(_particlesPos[i].x, _particlesPos[i].y);
             _sprite.setRotation((float)(std::fmod(i * 37.0, 360.0)));
-            window.draw(_sprite);
+            queue.submitSprite(RenderLayer::Particles, _sprite);
         } else {
-            sf::CircleShape c(3.0f);
-            c.setOrigin(3.0f, 3.0f);
-            c.setPosition(_particlesPos[i].x, _particlesPos[i].y);
-            c.setFillColor(!_isDone ? sf::Color::Red : sf::Color(120, 40, 40));
-            window.draw(c);
+            // untextured fallback: a 6px square per particle
+            const float r = 3.0f;
+            const float x = _particlesPos[i].x, y = _particlesPos[i].y;
+            const sf::Color c = !_isDone ? sf::Color::Red : sf::Color(120, 40, 40);
+            const sf::Vertex quad[4] = {
+                sf::Vertex(sf::Vector2f(x - r, y - r), c), sf::Vertex(sf::Vector2f(x + r, y - r), c),
+                sf::Vertex(sf::Vector2f(x + r, y + r), c), sf::Vertex(sf::Vector2f(x - r, y + r), c)
+            };
+            queue.submitQuads(RenderLayer::Particles, nullptr, sf::BlendAlpha, quad, 4);
         }
     }
 }
@@ -121,6 +126,21 @@ void Guts::updateAll(float dt) {
     }
 }
 
-void Guts::renderAll(sf::RenderWindow& window) {
-    for (auto g : _active) g->render(window);
+sf::FloatRect Guts::getBounds() const {
+    if (_particlesPos.empty()) return sf::FloatRect();
+    float minX = _particlesPos[0].x, maxX = minX, minY = _particlesPos[0].y, maxY = minY;
+    for (const Vec2& p : _particlesPos) {
+        minX = std::min(minX, p.x); maxX = std::max(maxX, p.x);
+        minY = std::min(minY, p.y); maxY = std::max(maxY, p.y);
+    }
+    // particles are small (3px circles or the texture at 5% scale)
+    const float margin = 4.0f;
+    return sf::FloatRect(minX - margin, minY - margin, maxX - minX + margin * 2.f, maxY - minY + margin * 2.f);
+}
+
+void Guts::renderAll(RenderQueue& queue, ViewCuller& culler) {
+    for (auto g : _active) {
+        if (g->_particlesPos.empty()) continue;
+        if (culler.accept(ViewCuller::Category::Guts, g->getBounds())) g->render(queue);
+    }
 }
\ No newline at end of file
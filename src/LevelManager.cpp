@@ -1,5 +1,10 @@
 #include "LevelManager.h"
 #include "PhysicsWorld.h"
+#include "GameRandom.h"
+#include "MortonOrder.h"
+#include "ZombieBehavior.h"
+#include "RenderStats.h"
+#include "SdfFont.h"
 #
  // Implement setters declared in header
 void LevelManager::setKeyIcon1(const sf::Texture& tex) { keyIcon1 = &tex; }
@@ -176,6 +181,11 @@ LevelManager::LevelManager()
     levelStartText.setFillColor(sf::Color::White);
     levelStartText.setPosition(300, 500);
 
+    // Rasterize the HUD and dialog glyph styles now instead of on the first frame that shows them
+    prewarmGlyphs(font4, { { 40, false, 0.f }, { 40, false, 2.f }, { 48, false, 0.f } }); // zombie count, level start
+    prewarmGlyphs(font2, { { 20, false, 0.f }, { 16, false, 0.f } });                     // dialog, skip prompt
+    prewarmGlyphs(font3, { { 48, false, 0.f }, { 26, false, 0.f } }, "0123456789/");      // ammo panels
+
     // FIGURABLE ROUND SETTINGS - edit values here to change per-round zombie behavior
     initializeDefaultConfigs();
 
@@ -194,6 +204,11 @@ void LevelManager::initialize() {
 void LevelManager::update(float deltaTime, Player& player) {
 
     previousLevel = currentLevel;
+    // Cleared each step so states that don't update zombies report zero AI time
+    lastZombieUpdateMs = 0.0;
+    lastMortonReorderMs = 0.0;
+
+    corpses.update(deltaTime);
 
     // --- Health damage flash handling (track when player loses health) ---
     float currHealthPercent = 1.0f;
@@ -219,6 +234,8 @@ void LevelManager::update(float deltaTime, Player& player) {
     sf::Vector2f mapSize = getMapSize();
     mapBounds.setSize(mapSize);
     transitionRect.setSize(mapSize);
+    noiseField.setBounds(sf::Vector2f(-noiseFieldPadding, -noiseFieldPadding),
+                         sf::Vector2f(mapSize.x + noiseFieldPadding * 2.0f, mapSize.y + noiseFieldPadding * 2.0f));
 
     // Debug logging throttle (print once per second)
     static float lmDebugTimer = 0.0f;
@@ -364,27 +381,51 @@ void LevelManager::update(float deltaTime, Player& player) {
 
         case GameState::BOSS_FIGHT:
             updateZombies(deltaTime, player);
+            {
+                // Projectiles may start a little outside the map (boss off-screen) before flying in
+                const float pad = 256.0f;
+                sf::FloatRect bounds(-pad, -pad, mapSize.x + pad * 2.0f, mapSize.y + pad * 2.0f);
+                static const std::vector<PhysicsBody*> noStatics;
+                const std::vector<PhysicsBody*>& statics = physicsWorld ? physicsWorld->staticBodies : noStatics;
+                float dmg = enemyProjectiles.update(deltaTime, player.isDead() ? nullptr : &player.getBody(), statics, bounds);
+                if (dmg > 0.0f) player.takeDamage(dmg);
+            }
             if (zombiesKilledInRound == totalZombiesInRound && zombiesSpawnedInRound == totalZombiesInRound) setGameState(GameState::VICTORY);
             break;
 
+        case GameState::HORDE:
+            // Endless: no victory condition, the target count only ever ramps up
+            updateHorde(deltaTime, player);
+            break;
+
         case GameState::GAME_OVER:
         case GameState::VICTORY:
             break;
     }
 }
 
-void LevelManager::draw(sf::RenderWindow& window) {
-    drawZombies(window);
+void LevelManager::draw(RenderQueue& queue, ViewCuller& culler) {
+    // corpses lie on the ground under the living (RenderLayer::Corpses)
+    corpses.draw(queue);
+    drawZombies(queue, culler);
 }
 
-void LevelManager::renderBullets(sf::RenderWindow& window, std::vector<std::unique_ptr<Bullet>>& bullets, float renderAlpha) {
+void LevelManager::renderBullets(RenderQueue& queue, std::vector<std::unique_ptr<Bullet>>& bullets, ViewCuller& culler) {
+    // bullets are tiny; the radius covers the sprite offset from the body
+    const float bulletCullRadius = 48.0f;
     for (auto& b : bullets) {
-        b->setRenderAlpha(renderAlpha);
-        b->render(window);
+        const Vec2& p = b->getBody().position;
+        if (!culler.accept(ViewCuller::Category::Bullets, sf::Vector2f(p.x, p.y), bulletCullRadius)) continue;
+        b->render(queue);
     }
 }
 
-void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
+void LevelManager::renderEnemyProjectiles(RenderQueue& queue, float renderAlpha) {
+    enemyProjectiles.draw(queue, renderAlpha);
+}
+
+void LevelManager::renderUI(sf::RenderTarget& window, sf::Font& font) {
+    InstrumentedTarget hud(window, RenderPass::Hud);
     // Existing dialog handling (unchanged)
     if (showingDialog && currentDialogIndex < tutorialDialogs.size()) {
         dialogText.setFont(this->font2);
@@ -396,7 +437,7 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
         sf::Vector2u winSize = window.getSize();
         transitionRect.setSize(sf::Vector2f(static_cast<float>(winSize.x), static_cast<float>(winSize.y)));
         transitionRect.setPosition(0.f, 0.f);
-        window.draw(transitionRect);
+        hud.draw(transitionRect);
     }
 
     if (levelTransitioning && (transitionState == TransitionState::FADE_IN || transitionState == TransitionState::SHOW_TEXT)) {
@@ -408,11 +449,12 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
         levelStartText.setString(levelTextString);
         sf::Vector2u windowSize = window.getSize();
         levelStartText.setPosition((windowSize.x - levelStartText.getGlobalBounds().width) / 2, windowSize.y / 2 - 50);
-        window.draw(levelStartText);
+        hud.draw(levelStartText);
     }
 
     // Draw round tally mark in top-right with cross-fade to upcoming texture during transitions.
-    {
+    // Horde mode has no rounds, so the tally is hidden there.
+    if (gameState != GameState::HORDE) {
         sf::Vector2u windowSize = window.getSize();
         float winW = static_cast<float>(windowSize.x);
         float winH = static_cast<float>(windowSize.y);
@@ -446,7 +488,7 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
             // compute alpha and apply only alpha so PNG colors remain intact
             sf::Uint8 a = static_cast<sf::Uint8>(255 * alphaMul);
             s.setColor(sf::Color(255, 255, 255, a));
-            window.draw(s);
+            hud.draw(s);
             s.setColor(prev);
             };
 
@@ -519,14 +561,16 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
     // Single zombie count draw (top-left). Kept here to avoid duplicate draws.
     if (!levelTransitioning || (levelTransitioning && (transitionState == TransitionState::FADE_OUT || transitionState == TransitionState::FADE_IN))) {
         // Only show zombie count in top-left; remove level/round text
-        sf::Text zombieCountText;
-        zombieCountText.setFont(font4);
-        zombieCountText.setCharacterSize(40);
-        // use an explicit padding constant for clarity
-        const float uiPadding = 10.f;
-        zombieCountText.setPosition(uiPadding + 2.f, uiPadding + 6.f);
-        // add a black outline so the text is readable over varying backgrounds
-        zombieCountText.setOutlineThickness(2.f);
+        if (!zombieCountTextReady) {
+            zombieCountText.setFont(font4);
+            zombieCountText.setCharacterSize(40);
+            // use an explicit padding constant for clarity
+            const float uiPadding = 10.f;
+            zombieCountText.setPosition(uiPadding + 2.f, uiPadding + 6.f);
+            // add a black outline so the text is readable over varying backgrounds
+            zombieCountText.setOutlineThickness(2.f);
+            zombieCountTextReady = true;
+        }
 
         sf::Uint8 alpha = 255;
         if (levelTransitioning) {
@@ -538,8 +582,16 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
         // apply fill and outline with the current alpha so both fade correctly during transitions
         zombieCountText.setFillColor(sf::Color(255, 255, 255, alpha));
         zombieCountText.setOutlineColor(sf::Color(0, 0, 0, alpha));
-        zombieCountText.setString("Zombies Left: " + std::to_string(zombies.size() + zombiesToSpawn.size()));
-        window.draw(zombieCountText);
+        // The string (and its glyph geometry) is only rebuilt when the count changes
+        const bool horde = gameState == GameState::HORDE;
+        const size_t count = horde ? zombies.size() : zombies.size() + zombiesToSpawn.size();
+        if (count != shownZombieCount || horde != shownZombieCountHorde) {
+            shownZombieCount = count;
+            shownZombieCountHorde = horde;
+            if (horde) zombieCountText.setString("Horde: " + std::to_string(count));
+            else zombieCountText.setString("Zombies Left: " + std::to_string(count));
+        }
+        hud.draw(zombieCountText);
     }
 }
 
@@ -565,6 +617,8 @@ void LevelManager::reset() {
 
     zombies.clear();
     zombiesToSpawn.clear();
+    // Old gunshots must not steer the next run's zombies (setBounds keeps a same-size grid)
+    noiseField.clear();
     tutorialComplete = false;
     tutorialZombiesSpawned = false;
     currentDialogIndex = 0;
@@ -585,7 +639,11 @@ void LevelManager::reset() {
 
 GameState LevelManager::getCurrentState() const { return gameState; }
 
-void LevelManager::setGameState(GameState state) { gameState = state; }
+void LevelManager::setGameState(GameState state) {
+    // Boss projectiles only exist during the boss fight
+    if (state != GameState::BOSS_FIGHT) enemyProjectiles.clear();
+    gameState = state;
+}
 
 void LevelManager::startTutorial() {
     currentLevel = 0;
@@ -622,6 +680,7 @@ void LevelManager::loadLevel(int levelNumber) {
     }
     zombies.clear();
     zombiesToSpawn.clear();
+    noiseField.clear();
     totalZombiesInRound = 0;
     zombiesSpawnedInRound = 0;
     zombiesKilledInRound = 0;
@@ -651,6 +710,11 @@ void LevelManager::loadLevel(int levelNumber) {
 }
 
 void LevelManager::restartCurrentRound(const sf::Vector2f& playerPos) {
+    // Horde mode has no rounds: a retry restarts the ramp from the beginning
+    if (gameState == GameState::HORDE) {
+        startHorde(playerPos);
+        return;
+    }
         // Clear active zombies & recycle pool indices (same pattern used in loadLevel/reset)
         for (auto zb : zombies) {
         if (physicsWorld) physicsWorld->removeBody(&zb->getBody());
@@ -664,6 +728,7 @@ void LevelManager::restartCurrentRound(const sf::Vector2f& playerPos) {
     }
     zombies.clear();
     zombiesToSpawn.clear();
+    noiseField.clear();
     
     // Reset per-round counters but keep currentLevel and currentRound unchanged
     zombiesSpawnedInRound = 0;
@@ -702,8 +767,7 @@ void LevelManager::spawnZombies(int count, sf::Vector2f playerPos) {
     zombiesKilledInRound = 0;
     zombieSpawnTimer = 0.0f;
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    std::mt19937& gen = GameRandom::engine();
     std::uniform_int_distribution<> sideDist(0, 3);
 
     sf::Vector2f mapSize = getMapSize();
@@ -794,6 +858,102 @@ void LevelManager::spawnZombies(int count, sf::Vector2f playerPos) {
     roundStarted = true;
  }
 
+void LevelManager::startHorde(const sf::Vector2f& playerPos) {
+    // Unregister any active zombies' physics bodies and recycle their pool indices
+    for (auto zb : zombies) {
+        if (physicsWorld) physicsWorld->removeBody(&zb->getBody());
+        auto mit = poolIndexByPtr.find(zb);
+        if (mit != poolIndexByPtr.end()) {
+            freeZombieIndices.push_back(mit->second);
+            poolIndexByPtr.erase(mit);
+        }
+    }
+    zombies.clear();
+    zombiesToSpawn.clear();
+    noiseField.clear();
+
+    // Horde runs on the level 0 map with no dialog, tallies or transitions
+    currentLevel = 0;
+    previousLevel = 0;
+    currentRound = 0;
+    tutorialComplete = true;
+    tutorialZombiesSpawned = false;
+    currentDialogIndex = static_cast<int>(tutorialDialogs.size());
+    showingDialog = false;
+    pendingLevelTransition = false;
+    inRoundTransition = false;
+    roundTransitionTimer = 0.0f;
+    levelTransitioning = false;
+    levelTransitionTimer = 0.0f;
+    transitionState = TransitionState::NONE;
+    totalZombiesInRound = 0;
+    zombiesSpawnedInRound = 0;
+    zombiesKilledInRound = 0;
+    zombieSpawnTimer = 0.0f;
+    roundStarted = true;
+
+    hordeElapsed = 0.0f;
+    gameState = GameState::HORDE;
+
+    ensurePoolSize(std::min(hordeConfig.maxActive, std::max(hordeConfig.poolGrowChunk, hordeConfig.startCount)));
+    queueHordeSpawns(getHordeTargetCount(), playerPos);
+}
+
+int LevelManager::getHordeTargetCount() const {
+    int ramp = hordeConfig.startCount + static_cast<int>(hordeConfig.rampPerSecond * hordeElapsed);
+    return std::clamp(ramp, 0, std::max(0, hordeConfig.maxActive));
+}
+
+void LevelManager::queueHordeSpawns(int count, const sf::Vector2f& playerPos) {
+    if (count <= 0) return;
+    std::mt19937& gen = GameRandom::engine();
+
+    // Same off-screen ring as spawnZombies: just outside the camera half-diagonal, spread outward
+    float halfW = cameraViewRect.width * 0.5f;
+    float halfH = cameraViewRect.height * 0.5f;
+    float camHalfDiag = std::sqrt(halfW*halfW + halfH*halfH);
+    float minR = std::max(200.0f, camHalfDiag + 32.0f);
+    float maxR = minR + std::max(cameraViewRect.width, cameraViewRect.height) * 0.8f;
+    std::uniform_real_distribution<float> angDist(0.0f, 2.0f * 3.14159265f);
+    std::uniform_real_distribution<float> radDist(minR, maxR);
+
+    for (int i = 0; i < count; ++i) {
+        float ang = angDist(gen);
+        float r = radDist(gen);
+        LevelManager::SpawnRequest req;
+        req.x = playerPos.x + std::cos(ang) * r;
+        req.y = playerPos.y + std::sin(ang) * r;
+        req.health = hordeConfig.health;
+        req.damage = hordeConfig.damage;
+        req.speed = hordeConfig.speed;
+        req.animSpeed = hordeConfig.animSpeed;
+        zombiesToSpawn.push_back(req);
+    }
+}
+
+void LevelManager::updateHorde(float deltaTime, Player& player) {
+    hordeElapsed += deltaTime;
+    sf::Vector2f playerPos = player.getPhysicsPosition();
+
+    int target = getHordeTargetCount();
+    int pending = static_cast<int>(zombies.size() + zombiesToSpawn.size());
+    if (pending < target) {
+        // Grow the pool ahead of the ramp in chunks so construction cost is spread out
+        int chunk = std::max(1, hordeConfig.poolGrowChunk);
+        int poolTarget = std::min(hordeConfig.maxActive, ((target + chunk - 1) / chunk) * chunk);
+        ensurePoolSize(poolTarget);
+        queueHordeSpawns(target - pending, playerPos);
+    }
+
+    // Activate only as many as there are free pool slots (activateQueuedZombies drops a request if the pool is empty)
+    if (!zombiesToSpawn.empty()) {
+        int n = std::min(hordeConfig.activatePerStep, static_cast<int>(freeZombieIndices.size()));
+        if (n > 0) activateQueuedZombies(n, playerPos);
+    }
+
+    updateZombies(deltaTime, player);
+}
+
 void LevelManager::activateQueuedZombies(int maxToActivate, const sf::Vector2f& playerPos) {
 
     int activated = 0;
@@ -837,6 +997,8 @@ void LevelManager::activateQueuedZombies(int maxToActivate, const sf::Vector2f&
             // Apply per-spawn animation speed if supported (computed when queued)
             z->setWalkFrameTime(req.animSpeed);
             if (shadowTexture) z->setShadowTexture(*shadowTexture);
+            // New arrivals start out heading for where the player was when they spawned
+            z->setLastKnownPlayerPos(playerPos);
 
             // Register in physics world now
             if (physicsWorld) physicsWorld->addBody(&z->getBody(), false);
@@ -851,423 +1013,147 @@ void LevelManager::activateQueuedZombies(int maxToActivate, const sf::Vector2f&
     }
 }
 
+// Zombies spawn off-screen (possibly outside the map), so the quantization grid starts well before 0,0
+static constexpr float kMortonOrigin = -4096.0f;
+
+void LevelManager::reorderByMorton() {
+    auto t0 = std::chrono::steady_clock::now();
+    // The zombie objects themselves stay in their pool slots; only the iteration order of the
+    // active list and the physics dynamic bodies changes. Both use the same key so a zombie and
+    // its body end up in matching relative positions. The physics broadphase builds its contiguous
+    // cell-sorted entries from dynamicBodies on the same grid, so an ordered array sorts in one
+    // linear pass and neighbouring cells sit next to each other in memory.
+    Morton::incrementalSort(zombies, mortonKeys, [&](BaseZombie* z) {
+        const Vec2& p = z->getBody().position;
+        return Morton::key(p.x, p.y, kMortonOrigin, kMortonOrigin, mortonCellSize);
+    }, mortonMaxMovesPerPass);
+    if (physicsWorld) physicsWorld->reorderDynamicBodiesByMorton(kMortonOrigin, kMortonOrigin, mortonCellSize, mortonMaxMovesPerPass);
+    lastMortonReorderMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
 void LevelManager::updateZombies(float deltaTime, const Player& player) {
-    // Update active zombies
-    // Use index-based loop since zombies vector may be modified during iteration
-    for (size_t i = 0; i < zombies.size(); ++i) {
-        zombies[i]->update(deltaTime, player.getPhysicsPosition());
+    if (mortonOrderingEnabled) {
+        mortonReorderTimer += deltaTime;
+        if (mortonReorderTimer >= mortonReorderInterval) {
+            mortonReorderTimer = 0.0f;
+            reorderByMorton();
+        }
     }
 
-    // Remove dead zombies and recycle them back into the pool
+    auto t0 = std::chrono::steady_clock::now();
+    sf::Vector2f playerPos = player.getPhysicsPosition();
+
+    // Pick an animation LOD per zombie before updating. The view rect is padded so zombies whose
+    // sprite overlaps the screen edge still count as visible.
+    sf::FloatRect lodRect(cameraViewRect.left - animLODViewPadding, cameraViewRect.top - animLODViewPadding,
+                          cameraViewRect.width + animLODViewPadding * 2.0f, cameraViewRect.height + animLODViewPadding * 2.0f);
+    const float halfRateDist2 = animLODHalfRateDistance * animLODHalfRateDistance;
+
+    if (noisePerceptionEnabled) noiseField.update(deltaTime);
+
+    for (BaseZombie* z : zombies) {
+        sf::Vector2f zp = z->getPosition();
+        // Zombies on (or just off) screen can see the player; the same rect drives animation LOD
+        bool onScreen = lodRect.contains(zp);
+        z->setPlayerInSight(!noisePerceptionEnabled || onScreen);
+
+        Animator::LOD lod = Animator::LOD::Full;
+        if (animationLODEnabled) {
+            if (!onScreen) {
+                lod = Animator::LOD::Logical;
+            } else {
+                float dx = zp.x - playerPos.x;
+                float dy = zp.y - playerPos.y;
+                if (dx*dx + dy*dy > halfRateDist2) lod = Animator::LOD::Half;
+            }
+        }
+        z->setAnimationLOD(lod);
+    }
+
+    // Every active zombie comes from the walker pool, so the whole list is stepped by the
+    // walker instantiation of the table-driven behaviour (no per-zombie virtual dispatch)
+    ZombieBehavior<ZombieWalker::kType>::updateBatch(zombies, deltaTime, playerPos, noisePerceptionEnabled ? &noiseField : nullptr);
+
+    // Remove dead zombies and recycle them back into the pool. Melee damage is applied by Game's
+    // CombatSystem, so zombies it killed are picked up here on the next step.
     auto it = zombies.begin();
     while (it != zombies.end()) {
         BaseZombie* zb = *it;
-        bool erased = false;
-        if (zb->isDead()) {
-            // remove physics body
-            if (physicsWorld) physicsWorld->removeBody(&zb->getBody());
-            // find pool index for this pointer
-            auto mit = poolIndexByPtr.find(zb);
-            if (mit != poolIndexByPtr.end()) {
-                int idx = mit->second;
-                poolIndexByPtr.erase(mit);
-                freeZombieIndices.push_back(idx);
-                // Optionally reset zombie visuals here
-            }
-            it = zombies.erase(it);
-            erased = true;
-            zombiesKilledInRound++;
-        } else if (player.isAttacking() && player.getAttackBounds().intersects(zb->getHitbox())) {
-            zb->takeDamage(player.getAttackDamage());
-            if (zb->isDead()) {
-                if (physicsWorld) physicsWorld->removeBody(&zb->getBody());
-                auto mit = poolIndexByPtr.find(zb);
-                if (mit != poolIndexByPtr.end()) {
-                    int idx = mit->second;
-                    poolIndexByPtr.erase(mit);
-                    freeZombieIndices.push_back(idx);
-                }
-                it = zombies.erase(it);
-                erased = true;
-                zombiesKilledInRound++;
-            }
+        if (!zb->isDead()) { ++it; continue; }
+        // Hand the last frame to the corpse system; the pool slot is free immediately
+        corpses.spawn(zb->getSprite(), zb->getPosition(), ZombieTraits<ZombieWalker::kType>::corpse);
+        // remove physics body
+        if (physicsWorld) physicsWorld->removeBody(&zb->getBody());
+        // find pool index for this pointer
+        auto mit = poolIndexByPtr.find(zb);
+        if (mit != poolIndexByPtr.end()) {
+            int idx = mit->second;
+            poolIndexByPtr.erase(mit);
+            freeZombieIndices.push_back(idx);
         }
-        if (!erased) ++it;
+        it = zombies.erase(it);
+        zombiesKilledInRound++;
     }
+
+    lastZombieUpdateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
 }
 
-void LevelManager::drawZombies(sf::RenderWindow& window) const {
-    for (const auto& zombie : zombies) zombie->draw(window);
+void LevelManager::drawZombies(RenderQueue& queue, ViewCuller& culler) {
+    // Spawns start off-screen, so a large share of the horde is usually culled here
+    visibleZombies.clear();
+    for (BaseZombie* zombie : zombies) {
+        if (culler.accept(ViewCuller::Category::Zombies, zombie->getBounds())) visibleZombies.push_back(zombie);
+    }
+    for (BaseZombie* zombie : visibleZombies) {
+        zombie->drawShadowAndHealthBar(shadowBars);
+        zombie->draw(queue);
+    }
+    shadowBars.submit(queue);
 }
 
 std::vector<BaseZombie*>& LevelManager::getZombies() { return zombies; }
 
-void LevelManager::drawHUD(sf::RenderWindow& window, const Player& player) {
-    sf::Vector2u windowSize = window.getSize();
-    float barWidth = 200;
-    float barHeight = 20;
-    float padding = 10;
-
-    // Draw health and stamina bars in bottom-left
-    // Longer and skinnier bars
-    float hudBarWidth = 340.f;
-    float hudBarHeight = 10.f;
-    float hudPadding = 20.f;
-    float hudSpacing = 8.f;
-    // Vertical raise for HUD elements (positive moves them upward)
-    float hudVerticalRaise = 20.f; // tweak this value to move bars/panels up/down
-    float hudStaminaY = static_cast<float>(windowSize.y) - hudBarHeight - hudPadding - hudVerticalRaise;
-    float hudHealthY = hudStaminaY - hudBarHeight - hudSpacing;
-
-    // Container backdrop behind bars: draw a left-opaque -> right-transparent gradient
-    float containerPad = 10.f;
-    float containerX = hudPadding - containerPad;
-    float containerY = hudHealthY - containerPad;
-    float containerW = hudBarWidth + containerPad * 2.f;
-    float containerH = hudBarHeight * 2.f + hudSpacing + containerPad * 2.f;
-
-    // Make left side start more transparent (lower alpha)
-    sf::Color opaqueCol(10,10,10,100);
-    sf::Color transparentCol(10,10,10,0);
-    // Build two triangles to form a rectangle with horizontal gradient
-    sf::VertexArray grad(sf::Triangles, 6);
-    // Triangle 1: tl, bl, tr
-    grad[0].position = sf::Vector2f(containerX, containerY); grad[0].color = opaqueCol; // top-left
-    grad[1].position = sf::Vector2f(containerX, containerY + containerH); grad[1].color = opaqueCol; // bottom-left
-    grad[2].position = sf::Vector2f(containerX + containerW, containerY); grad[2].color = transparentCol; // top-right
-    // Triangle 2: tr, bl, br
-    grad[3].position = sf::Vector2f(containerX + containerW, containerY); grad[3].color = transparentCol; // top-right
-    grad[4].position = sf::Vector2f(containerX, containerY + containerH); grad[4].color = opaqueCol; // bottom-left
-    grad[5].position = sf::Vector2f(containerX + containerW, containerY + containerH); grad[5].color = transparentCol; // bottom-right
-
-    window.draw(grad);
-
-    // Backgrounds
-    sf::RectangleShape healthBg(sf::Vector2f(hudBarWidth, hudBarHeight));
-    healthBg.setFillColor(sf::Color(40, 40, 40, 200));
-    healthBg.setOutlineColor(sf::Color(100,100,100,180));
-    healthBg.setOutlineThickness(1.f);
-    healthBg.setPosition(hudPadding, hudHealthY);
-
-    sf::RectangleShape staminaBg(sf::Vector2f(hudBarWidth, hudBarHeight));
-    staminaBg.setFillColor(sf::Color(40, 40, 40, 200));
-    staminaBg.setOutlineColor(sf::Color(100,100,100,180));
-    staminaBg.setOutlineThickness(1.f);
-    staminaBg.setPosition(hudPadding, hudStaminaY);
-
-    // Filled bars
-    float healthPercent = 0.0f;
-    if (player.getMaxHealth() > 0.0f) healthPercent = player.getCurrentHealth() / player.getMaxHealth();
-    healthPercent = std::clamp(healthPercent, 0.0f, 1.0f);
-    sf::RectangleShape healthFill(sf::Vector2f(hudBarWidth * healthPercent, hudBarHeight));
-    healthFill.setFillColor(sf::Color::Green);
-    healthFill.setPosition(hudPadding, hudHealthY);
-
-    // Precompute stamina fill so we can draw it after the health flash overlay
-    float staminaPercent = 0.0f;
-    if (player.getMaxStamina() > 0.0f) staminaPercent = player.getCurrentStamina() / player.getMaxStamina();
-    staminaPercent = std::clamp(staminaPercent, 0.0f, 1.0f);
-    sf::RectangleShape staminaFill(sf::Vector2f(hudBarWidth * staminaPercent, hudBarHeight));
-    staminaFill.setFillColor(sf::Color::White);
-    staminaFill.setPosition(hudPadding, hudStaminaY);
-
-    window.draw(healthBg);
-    window.draw(healthFill);
-    // If a damage flash is active, draw the missing portion as red on top of the health bar
-    if ((damageFlashRemaining > 0.0f || damageFlashHoldRemaining > 0.0f) && damageFlashStartPercent > healthPercent) {
-        float t = 1.0f;
-        if (damageFlashHoldRemaining > 0.0f) {
-            // hold phase: t==1.0, flash at full width
-            t = 1.0f;
-        } else {
-            // shrinking phase uses remaining/duration
-            t = damageFlashRemaining / damageFlashDuration; // 1->0
-        }
-        // current flash edge moves from damageFlashStartPercent -> healthPercent as t goes 1->0
-        float currentFlashEdge = healthPercent + (damageFlashStartPercent - healthPercent) * t;
-        float redWidth = hudBarWidth * (currentFlashEdge - healthPercent);
-        if (redWidth > 0.0f) {
-            sf::RectangleShape redFill(sf::Vector2f(redWidth, hudBarHeight));
-            redFill.setFillColor(sf::Color(200, 40, 40, 220));
-            redFill.setPosition(hudPadding + hudBarWidth * healthPercent, hudHealthY);
-            window.draw(redFill);
-        }
+void LevelManager::drawHUD(sf::RenderTarget& window, const Player& player) {
+    InstrumentedTarget hud(window, RenderPass::Hud);
+
+    HudValues values;
+    if (player.getMaxHealth() > 0.0f) values.health = std::clamp(player.getCurrentHealth() / player.getMaxHealth(), 0.0f, 1.0f);
+    else values.health = 0.0f;
+    if (player.getMaxStamina() > 0.0f) values.stamina = std::clamp(player.getCurrentStamina() / player.getMaxStamina(), 0.0f, 1.0f);
+    else values.stamina = 0.0f;
+    // Damage flash: the red edge holds at the pre-damage health, then shrinks back to the current health
+    if ((damageFlashRemaining > 0.0f || damageFlashHoldRemaining > 0.0f) && damageFlashStartPercent > values.health) {
+        float t = (damageFlashHoldRemaining > 0.0f) ? 1.0f : damageFlashRemaining / damageFlashDuration; // 1->0
+        values.damageFlashEdge = values.health + (damageFlashStartPercent - values.health) * t;
     }
-    window.draw(staminaBg);
-    window.draw(staminaFill);
-
-    // Two stacked dark transparent panels in bottom-right with padding between them
-    {
-        const float panelWidth = 240.f;
-        const float panelHeight = 64.f;
-        const float panelPadding = 16.f; // distance from screen edges
-        const float gap = 5.f; // space between stacked panels
-
-        float xTop = static_cast<float>(windowSize.x) - panelPadding - panelWidth;
-        // smaller dimensions for bottom panel
-        float panelBWidth = panelWidth * 0.82f;
-        float panelBHeight = panelHeight * 0.55f;
-        float xBottom = static_cast<float>(windowSize.x) - panelPadding - panelBWidth; // smaller than top
-        // bottom panel (panel B) anchored to bottom edge
-        float yBottom = static_cast<float>(windowSize.y) - panelPadding - panelBHeight - hudVerticalRaise;
-        // top panel (panel A) sits above bottom panel with gap
-        float yTop = yBottom - gap - panelHeight;
-
-        sf::RectangleShape panelA(sf::Vector2f(panelWidth, panelHeight));
-        panelA.setPosition(xTop, yTop);
-        panelA.setFillColor(sf::Color(0, 0, 0, 160)); // dark, semi-transparent
-
-        sf::RectangleShape panelB(sf::Vector2f(panelBWidth, panelBHeight));
-        panelB.setPosition(xBottom, yBottom);
-        panelB.setFillColor(sf::Color(0, 0, 0, 160));
-
-        window.draw(panelA);
-        // Draw lower panel so it is visible (must be drawn before top panel outlines)
-        window.draw(panelB);
-
-        // Draw weapon icons INSIDE the panels. Draw these before the outlines/bracket lines
-        // so the white accent lines remain visible on top.
-        const float iconPadding = 2.0f; // small padding inside panel
-        // drawIconInPanel now takes an optional size multiplier. It clamps the final scale
-        // so the sprite never draws outside the available panel area.
-        auto drawIconInPanel = [&](const sf::Texture* tex, float px, float py, float pW, float pH, float mul = 1.0f) {
-             if (!tex) return;
-             sf::Sprite s; s.setTexture(*tex);
-             float texW = static_cast<float>(tex->getSize().x);
-             float texH = static_cast<float>(tex->getSize().y);
-             float availW = pW - iconPadding * 2.0f;
-             float availH = pH - iconPadding * 2.0f;
-             if (availW <= 0 || availH <= 0 || texW <= 0 || texH <= 0) return;
-             // base scale that fits the texture into the available box
-             float baseScale = std::min(availW / texW, availH / texH);
-             // apply multiplier but clamp to the maximum that still fits
-             float appliedScale = baseScale * mul;
-             s.setScale(appliedScale, appliedScale);
-             float drawW = texW * appliedScale;
-             float drawH = texH * appliedScale;
-             // center inside panel area (respect padding)
-             float posX = px + (pW - drawW) * 0.5f;
-             float posY = py + (pH - drawH) * 0.5f;
-             s.setPosition(posX, posY);
-             window.draw(s);
-         };
-
-        const sf::Texture* topTex = nullptr;
-        const sf::Texture* bottomTex = nullptr;
-        if (player.getCurrentWeapon() == WeaponType::PISTOL) {
-            topTex = pistolIcon;
-            bottomTex = rifleIcon;
-        } else {
-            topTex = rifleIcon;
-            bottomTex = pistolIcon;
-        }
-        // Use per-icon scale multipliers (1.0 = fit to panel). Apply the correct scale
-        // to the top (equipped) and bottom (other) icon depending on the player's weapon.
-        float topMul = 1.0f;
-        float bottomMul = 1.0f;
-        if (player.getCurrentWeapon() == WeaponType::PISTOL) {
-            // pistol is on top panel
-            topMul = pistolTopScale;
-            bottomMul = rifleBottomScale;
-        } else {
-            // rifle is on top panel
-            topMul = rifleTopScale;
-            bottomMul = pistolBottomScale;
-        }
-
-        // Compute debug line X (same fraction used later) so we can center icons between panel left and the line
-        const float debugFrac = 0.55f; // same fraction used for TEMP debug line
-        float lx = xTop + panelWidth * debugFrac;
-
-        // Draw an icon centered between the left edge of the panel (px) and the vertical line lx.
-        auto drawIconCenteredBetween = [&](const sf::Texture* tex, float px, float py, float pW, float pH, float mul, float lineX) {
-             if (!tex) return;
-             sf::Sprite s; s.setTexture(*tex);
-             float texW = static_cast<float>(tex->getSize().x);
-             float texH = static_cast<float>(tex->getSize().y);
-
-             const float pad = 2.0f;
-             // horizontal slot is from px+pad .. lineX - pad
-             float slotLeft = px + pad;
-             float slotRight = lineX - pad;
-             float slotW = slotRight - slotLeft;
-             if (slotW < 8.f) slotW = std::max(8.f, pW - pad*2.f);
-             // vertical slot uses panel height
-             float slotH = pH - pad * 2.0f;
-             if (slotH < 8.f) slotH = pH - pad*2.f;
-
-             // Compute baseScale to fit inside the slot (respecting both width and height)
-             float baseScale = 1.0f;
-             if (texW > 0 && texH > 0) baseScale = std::min(slotW / texW, slotH / texH);
-             float appliedScale = baseScale * mul;
-             s.setScale(appliedScale, appliedScale);
-
-             float drawW = texW * appliedScale;
-             float drawH = texH * appliedScale;
-
-             // center inside the horizontal slot and vertically inside panel
-             float posX = slotLeft + (slotW - drawW) * 0.5f;
-             float posY = py + pad + (slotH - drawH) * 0.5f;
-             s.setPosition(posX, posY);
-             window.draw(s);
-         };
-
-        // Draw icons centered between their panel left edge and the debug line lx
-        drawIconCenteredBetween(topTex, xTop, yTop, panelWidth, panelHeight, topMul, lx);
-        drawIconCenteredBetween(bottomTex, xBottom, yBottom, panelBWidth, panelBHeight, bottomMul, lx);
-
-        // Draw key icon to the left of the bottom panel indicating which key equips the unequipped weapon
-        // Draw the PNG at its original pixel size (no scaling). If texture missing, draw nothing.
-        {
-            WeaponType topW = player.getCurrentWeapon();
-            WeaponType bottomW = (topW == WeaponType::PISTOL) ? WeaponType::RIFLE : WeaponType::PISTOL;
-            const sf::Texture* ktex = (bottomW == WeaponType::RIFLE) ? keyIcon1 : keyIcon2;
-            if (ktex && ktex->getSize().x > 0 && ktex->getSize().y > 0) {
-                sf::Sprite ks; ks.setTexture(*ktex);
-                // place sprite to the left of the bottom panel with a small gap
-                float gapBox = 8.0f;
-                // use original texture size in pixels
-                sf::Vector2u ts = ktex->getSize();
-                float spriteW = static_cast<float>(ts.x);
-                float spriteH = static_cast<float>(ts.y);
-                // compute position so sprite is vertically centered relative to bottom panel
-                float boxX = xBottom - gapBox - spriteW;
-                float boxY = yBottom + (panelBHeight - spriteH) * 0.5f;
-                ks.setScale(1.0f, 1.0f);
-                ks.setPosition(boxX, boxY);
-                window.draw(ks);
-            }
-        }
-
-        // For the top panel, draw the equipped weapon's ammo right-aligned inside the panel
-        {
-            int topAmmo = player.getCurrentAmmo();
-            int topMag = player.getMagazineSize();
-
-            sf::Text leftAmmoTop;
-            sf::Text rightAmmoTop;
-            leftAmmoTop.setFont(this->font3);
-            rightAmmoTop.setFont(this->font3);
-            unsigned int topCharSize = static_cast<unsigned int>(std::max(10.f, panelHeight * 0.75f));
-            leftAmmoTop.setCharacterSize(topCharSize);
-            rightAmmoTop.setCharacterSize(topCharSize);
-            leftAmmoTop.setFillColor(sf::Color::White);
-            rightAmmoTop.setFillColor(sf::Color(160,160,160));
-            leftAmmoTop.setString(std::to_string(topAmmo));
-            rightAmmoTop.setString(std::string("/") + std::to_string(topMag));
-
-            sf::FloatRect lbTop = leftAmmoTop.getLocalBounds();
-            sf::FloatRect rbTop = rightAmmoTop.getLocalBounds();
-            float totalWTop = (lbTop.width + lbTop.left) + (rbTop.width + rbTop.left);
-            float textStartXTop = xTop + panelWidth - 10.f - totalWTop; // 10px right padding
-            float textYTop = yTop + (panelHeight - (lbTop.height)) * 0.5f - lbTop.top;
-            leftAmmoTop.setPosition(textStartXTop - 4.f, textYTop);
-            rightAmmoTop.setPosition(textStartXTop + (lbTop.width + lbTop.left), textYTop);
-            window.draw(leftAmmoTop);
-            window.draw(rightAmmoTop);
-        }
-
-        // For the bottom panel, draw the unequipped weapon's ammo right-aligned inside the panel
-        {
-            WeaponType topW = player.getCurrentWeapon();
-            WeaponType bottomW = (topW == WeaponType::PISTOL) ? WeaponType::RIFLE : WeaponType::PISTOL;
-            int ammoVal = 0;
-            int magVal = 0;
-            if (bottomW == WeaponType::PISTOL) {
-                ammoVal = player.getPistolAmmoInMag();
-                magVal = 12; // pistol mag size
-            } else {
-                ammoVal = player.getRifleAmmoInMag();
-                magVal = 30; // rifle mag size
-            }
-            std::string ammoStr = std::to_string(ammoVal) + "/" + std::to_string(magVal);
-
-            // Render ammo as two parts: current ammo (white) and "/mag" (grey) so the slash and right numbers are grey
-            sf::Text leftAmmoText;
-            leftAmmoText.setFont(this->font3);
-            sf::Text rightAmmoText;
-            rightAmmoText.setFont(this->font3);
-            unsigned int charSize = static_cast<unsigned int>(std::max(10.f, panelBHeight * 0.75f));
-            leftAmmoText.setCharacterSize(charSize);
-            rightAmmoText.setCharacterSize(charSize);
-            leftAmmoText.setFillColor(sf::Color::White);
-            rightAmmoText.setFillColor(sf::Color(160,160,160)); // grey for slash and mag
-            leftAmmoText.setString(std::to_string(ammoVal));
-            rightAmmoText.setString(std::string("/") + std::to_string(magVal));
-
-            // Measure both parts to right-align the pair inside the bottom panel
-            sf::FloatRect lb = leftAmmoText.getLocalBounds();
-            sf::FloatRect rb = rightAmmoText.getLocalBounds();
-            float totalW = (lb.width + lb.left) + (rb.width + rb.left);
-            float textStartX = xBottom + panelBWidth - 10.f - totalW; // 10px right padding
-            float textY = yBottom + (panelBHeight - (lb.height)) * 0.5f - lb.top;
-            leftAmmoText.setPosition(textStartX - 4.f, textY);
-            rightAmmoText.setPosition(textStartX + (lb.width + lb.left), textY);
-            window.draw(leftAmmoText);
-            window.draw(rightAmmoText);
-         }
-
-        // Solid white side outlines on top panel
-         float outlineW = 2.0f;
-         sf::RectangleShape leftOutline(sf::Vector2f(outlineW, panelHeight));
-         leftOutline.setPosition(xTop, yTop);
-         leftOutline.setFillColor(sf::Color::White);
-         window.draw(leftOutline);
-
-         sf::RectangleShape rightOutline(sf::Vector2f(outlineW, panelHeight));
-         rightOutline.setPosition(xTop + panelWidth - outlineW, yTop);
-         rightOutline.setFillColor(sf::Color::White);
-         window.draw(rightOutline);
-
-         // Horizontal bracket lines that extend slightly inward from each side
-         float horizLen = panelWidth * 0.03f; // how far the bracket extends inward
-         float horizTh = outlineW; // thickness matches side outline
-         float vertInset = 0.0f; // vertical inset from top/bottom edges
-
-         // Top-left horizontal
-         sf::RectangleShape topLeftHor(sf::Vector2f(horizLen, horizTh));
-         topLeftHor.setPosition(xTop + outlineW, yTop + vertInset);
-         topLeftHor.setFillColor(sf::Color::White);
-         window.draw(topLeftHor);
-
-         // Bottom-left horizontal
-         sf::RectangleShape bottomLeftHor(sf::Vector2f(horizLen, horizTh));
-         bottomLeftHor.setPosition(xTop + outlineW, yTop + panelHeight - vertInset - horizTh);
-         bottomLeftHor.setFillColor(sf::Color::White);
-         window.draw(bottomLeftHor);
-
-         // Top-right horizontal (extends leftwards)
-         sf::RectangleShape topRightHor(sf::Vector2f(horizLen, horizTh));
-         topRightHor.setPosition(xTop + panelWidth - outlineW - horizLen, yTop + vertInset);
-         topRightHor.setFillColor(sf::Color::White);
-         window.draw(topRightHor);
-
-         // Bottom-right horizontal
-         sf::RectangleShape bottomRightHor(sf::Vector2f(horizLen, horizTh));
-         bottomRightHor.setPosition(xTop + panelWidth - outlineW - horizLen, yTop + panelHeight - vertInset - horizTh);
-         bottomRightHor.setFillColor(sf::Color::White);
-         window.draw(bottomRightHor);
-
-        // TEMP: draw a vertical debug line at 45% of the top panel width and continue it through the bottom panel
-        {
-            float frac = 0.55f; // fraction across the top panel where the line should be
-            float lx = xTop + panelWidth * frac;
-            // start at top panel top, end at bottom panel bottom (covers the gap between panels)
-            float yStart = yTop;
-            float yEnd = yBottom + panelBHeight;
-            sf::VertexArray vline(sf::Lines, 2);
-            vline[0].position = sf::Vector2f(lx, yStart);
-            vline[1].position = sf::Vector2f(lx, yEnd);
-            // Make debug line invisible by using fully transparent color
-            sf::Color dbgCol(255, 64, 64, 0);
-            vline[0].color = dbgCol;
-            vline[1].color = dbgCol;
-            window.draw(vline);
-        }
+    // Top panel shows the equipped weapon, the bottom panel the other one
+    values.rifleEquipped = player.getCurrentWeapon() != WeaponType::PISTOL;
+    values.topAmmo = player.getCurrentAmmo();
+    values.topMag = player.getMagazineSize();
+    if (values.rifleEquipped) {
+        values.bottomAmmo = player.getPistolAmmoInMag();
+        values.bottomMag = 12; // pistol mag size
+    } else {
+        values.bottomAmmo = player.getRifleAmmoInMag();
+        values.bottomMag = 30; // rifle mag size
     }
+
+    HudResources resources;
+    resources.font = &font3;
+    resources.pistolIcon = pistolIcon;
+    resources.rifleIcon = rifleIcon;
+    resources.keyIcon1 = keyIcon1;
+    resources.keyIcon2 = keyIcon2;
+    resources.pistolTopScale = pistolTopScale;
+    resources.pistolBottomScale = pistolBottomScale;
+    resources.rifleTopScale = rifleTopScale;
+    resources.rifleBottomScale = rifleBottomScale;
+
+    playerHud.draw(hud, window.getSize(), resources, values);
 }
 
-void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
+void LevelManager::showTutorialDialog(sf::RenderTarget& window) {
+    InstrumentedTarget hud(window, RenderPass::Hud);
     sf::Vector2u windowSize = window.getSize();
     dialogBox.setPosition((windowSize.x - dialogBox.getSize().x) / 2, windowSize.y - dialogBox.getSize().y - 20);
     dialogText.setPosition((dialogBox.getPosition().x + 10), dialogBox.getPosition().y + 10);
@@ -1283,7 +1169,7 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
         std::string wrapped = wrapText(dialogText, tutorialDialogs[currentDialogIndex], maxTextWidth, maxLines);
 
         // Draw dialog box and then each line separately with explicit spacing to avoid SFML auto-spacing issues
-        window.draw(dialogBox);
+        hud.draw(dialogBox);
 
         // If dialog contains the special token "----" draw the Esc icon inline.
         const std::string token = "----";
@@ -1319,7 +1205,7 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
                     sf::Sprite ks; ks.setTexture(*keyIconEsc);
                     ks.setScale(scale, scale);
                     ks.setPosition(curX, curY + (lineHeight - iconH) * 0.5f);
-                    window.draw(ks);
+                    hud.draw(ks);
                     curX += iconW + tmp.getLetterSpacing();
                 } else {
                     // measure word width including a trailing space
@@ -1329,7 +1215,7 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
                         curX = startX; curY += lineHeight;
                     }
                     tmp.setPosition(curX, curY);
-                    window.draw(tmp);
+                    hud.draw(tmp);
                     curX += w;
                 }
             }
@@ -1351,7 +1237,7 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
             for (size_t i = 0; i < lines.size(); ++i) {
                 lineText.setString(lines[i]);
                 lineText.setPosition(startX, startY + static_cast<float>(i) * lineHeight);
-                window.draw(lineText);
+                hud.draw(lineText);
             }
         }
         // Always draw the skip/continue prompt at bottom-right inside the dialog box
@@ -1365,10 +1251,10 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
         float spX = dialogBox.getPosition().x + dialogBox.getSize().x - padding - (spb.width + spb.left);
         float spY = dialogBox.getPosition().y + dialogBox.getSize().y - padding - (spb.height + spb.top);
         skipPrompt.setPosition(spX, spY);
-        window.draw(skipPrompt);
+        hud.draw(skipPrompt);
     } else {
         // still draw empty box if no dialog
-        window.draw(dialogBox);
+        hud.draw(dialogBox);
         // draw the prompt even when dialog is empty
         sf::Text skipPrompt;
         skipPrompt.setFont(this->font2);
@@ -1385,7 +1271,7 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
         float spX = dialogBox.getPosition().x + dialogBox.getSize().x - padding - (spb.width + spb.left);
         float spY = dialogBox.getPosition().y + dialogBox.getSize().y - padding - (spb.height + spb.top);
         skipPrompt.setPosition(spX, spY);
-        window.draw(skipPrompt);
+        hud.draw(skipPrompt);
     }
 }
 
@@ -1398,9 +1284,9 @@ void LevelManager::notifyPlayerDeath() {
 }
 
 // Add missing method implementations
-void LevelManager::render(sf::RenderWindow& window) {
-    // Render active world entities (zombies). Drawing of map/background is handled by Game.
-    draw(window);
+void LevelManager::render(RenderQueue& queue, ViewCuller& culler) {
+    // Submit active world entities (zombies). Map/background submissions are handled by Game.
+    draw(queue, culler);
 }
 
 void LevelManager::setPhysicsWorld(PhysicsWorld* world) {
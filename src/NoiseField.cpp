@@ -0,0 +1,95 @@
+#include "NoiseField.h"
+#include <algorithm>
+#include <cmath>
+
+void NoiseField::setBounds(const sf::Vector2f& o, const sf::Vector2f& s) {
+    if (o == origin && s == size && !cells.empty()) return;
+    origin = o;
+    size = s;
+    cols = std::max(1, static_cast<int>(std::ceil(size.x / cellSize)));
+    rows = std::max(1, static_cast<int>(std::ceil(size.y / cellSize)));
+    cells.assign(static_cast<size_t>(cols) * rows, 0.0f);
+    scratch.assign(cells.size(), 0.0f);
+    tickAccumulator = 0.0f;
+}
+
+void NoiseField::clear() {
+    std::fill(cells.begin(), cells.end(), 0.0f);
+    tickAccumulator = 0.0f;
+}
+
+void NoiseField::emit(const sf::Vector2f& pos, float loudness, float radius) {
+    if (cells.empty() || radius <= 0.0f) return;
+    const float fx = (pos.x - origin.x) / cellSize;
+    const float fy = (pos.y - origin.y) / cellSize;
+    const float rCells = radius / cellSize;
+    const int x0 = std::max(0, static_cast<int>(std::floor(fx - rCells)));
+    const int x1 = std::min(cols - 1, static_cast<int>(std::ceil(fx + rCells)));
+    const int y0 = std::max(0, static_cast<int>(std::floor(fy - rCells)));
+    const int y1 = std::min(rows - 1, static_cast<int>(std::ceil(fy + rCells)));
+    for (int cy = y0; cy <= y1; ++cy) {
+        for (int cx = x0; cx <= x1; ++cx) {
+            float dx = (cx + 0.5f) - fx;
+            float dy = (cy + 0.5f) - fy;
+            float d = std::sqrt(dx*dx + dy*dy);
+            if (d > rCells) continue;
+            float v = loudness * (1.0f - d / rCells);
+            // take the max so rapid fire doesn't pile up unbounded values
+            float& c = cells[index(cx, cy)];
+            c = std::max(c, v);
+        }
+    }
+}
+
+void NoiseField::update(float deltaTime) {
+    if (cells.empty()) return;
+    const float tickTime = 1.0f / tickRate;
+    tickAccumulator += deltaTime;
+    // cap catch-up work after a long stall
+    if (tickAccumulator > tickTime * 4.0f) tickAccumulator = tickTime * 4.0f;
+    while (tickAccumulator >= tickTime) {
+        tickAccumulator -= tickTime;
+        tick();
+    }
+}
+
+void NoiseField::tick() {
+    for (int cy = 0; cy < rows; ++cy) {
+        for (int cx = 0; cx < cols; ++cx) {
+            // edges reflect (missing neighbours use the cell itself) so noise doesn't drain off the border
+            float c = cells[index(cx, cy)];
+            float l = (cx > 0) ? cells[index(cx - 1, cy)] : c;
+            float r = (cx < cols - 1) ? cells[index(cx + 1, cy)] : c;
+            float u = (cy > 0) ? cells[index(cx, cy - 1)] : c;
+            float d = (cy < rows - 1) ? cells[index(cx, cy + 1)] : c;
+            float avg = (l + r + u + d) * 0.25f;
+            float v = (c + (avg - c) * diffusion) * decay;
+            scratch[index(cx, cy)] = (v < 1e-4f) ? 0.0f : v;
+        }
+    }
+    cells.swap(scratch);
+}
+
+float NoiseField::valueAt(int cx, int cy) const {
+    cx = std::clamp(cx, 0, cols - 1);
+    cy = std::clamp(cy, 0, rows - 1);
+    return cells[index(cx, cy)];
+}
+
+float NoiseField::sample(const sf::Vector2f& pos) const {
+    if (cells.empty()) return 0.0f;
+    int cx = static_cast<int>(std::floor((pos.x - origin.x) / cellSize));
+    int cy = static_cast<int>(std::floor((pos.y - origin.y) / cellSize));
+    if (cx < 0 || cy < 0 || cx >= cols || cy >= rows) return 0.0f;
+    return cells[index(cx, cy)];
+}
+
+sf::Vector2f NoiseField::gradient(const sf::Vector2f& pos) const {
+    if (cells.empty()) return sf::Vector2f(0.f, 0.f);
+    int cx = static_cast<int>(std::floor((pos.x - origin.x) / cellSize));
+    int cy = static_cast<int>(std::floor((pos.y - origin.y) / cellSize));
+    if (cx < 0 || cy < 0 || cx >= cols || cy >= rows) return sf::Vector2f(0.f, 0.f);
+    float gx = valueAt(cx + 1, cy) - valueAt(cx - 1, cy);
+    float gy = valueAt(cx, cy + 1) - valueAt(cx, cy - 1);
+    return sf::Vector2f(gx, gy);
+}
@@ -1,17 +1,8 @@
 #include "PhysicsBody.h"
+#include "DebugDraw.h"
 
 PhysicsBody::PhysicsBody(Vec2 position, Vec2 size, bool isStatic, float mass, bool isCircle)
     : position(position), size(size), isStatic(isStatic), mass(mass), isCircle(isCircle) {
-    // Initialize both shapes, one will be used depending on isCircle
-    rectShape.setSize(sf::Vector2f(size.x, size.y));
-    rectShape.setOrigin(size.x / 2, size.y / 2); // important
-    rectShape.setPosition(position.x, position.y);
-    rectShape.setFillColor(isStatic ? sf::Color::White : sf::Color::Red);
-
-    float radius = std::max(size.x, size.y) / 2.f;
-    circleShape.setRadius(radius);
-    circleShape.setOrigin(radius, radius);
-    circleShape.setFillColor(isStatic ? sf::Color::White : sf::Color::Blue);
 }
 
 void PhysicsBody::update(float dt) {
@@ -23,10 +14,6 @@ void PhysicsBody::update(float dt) {
         externalImpulse = externalImpulse * 0.9f;
 
     }
-
-    // Always update shape positions
-    rectShape.setPosition(position.x, position.y);
-    circleShape.setPosition(position.x, position.y);
 }
 
 void PhysicsBody::applyDamping(float factor) {
@@ -36,18 +23,14 @@ void PhysicsBody::applyDamping(float factor) {
     }
 }
 
-sf::Shape& PhysicsBody::getShape() {
-    return isCircle ? static_cast<sf::Shape&>(circleShape)
-        : static_cast<sf::Shape&>(rectShape);
-}
-
-const sf::Shape& PhysicsBody::getShape() const {
-    return isCircle ? static_cast<const sf::Shape&>(circleShape)
-        : static_cast<const sf::Shape&>(rectShape);
-}
-
-sf::CircleShape& PhysicsBody::getCircleShape() { return circleShape; }
-const sf::CircleShape& PhysicsBody::getCircleShape() const { return circleShape; }
-
-sf::RectangleShape& PhysicsBody::getRectShape() { return rectShape; }
-const sf::RectangleShape& PhysicsBody::getRectShape() const { return rectShape; }
\ No newline at end of file
+void PhysicsBody::reportDebugShape() const {
+    if (!DebugDraw::isEnabled()) return;
+    // static white, triggers yellow, dynamic circles blue and boxes red
+    sf::Color color = isStatic ? sf::Color::White : isTrigger ? sf::Color::Yellow : isCircle ? sf::Color::Blue : sf::Color::Red;
+    if (isCircle) {
+        // collision treats size.x as the diameter
+        DebugDraw::circle(sf::Vector2f(position.x, position.y), size.x / 2.f, color, 12);
+    } else {
+        DebugDraw::rect(sf::FloatRect(position.x - size.x / 2.f, position.y - size.y / 2.f, size.x, size.y), color);
+    }
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "PhysicsWorld.h"
 #include "Bullet.h"
 #include "BaseZombie.h"
+#include "MortonOrder.h"
+#include "DebugDraw.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -38,6 +41,21 @@ void PhysicsWorld::removeBody(PhysicsBody* body) {
     }
 }
 
+bool PhysicsWorld::reorderDynamicBodiesByMorton(float originX, float originY, float cellSize, size_t maxMoves) {
+    gridOriginX = originX;
+    gridOriginY = originY;
+    gridCellSize = cellSize;
+    return Morton::incrementalSort(dynamicBodies, mortonKeys, [&](PhysicsBody* b) {
+        return Morton::key(b->position.x, b->position.y, originX, originY, cellSize);
+    }, maxMoves);
+}
+
+void PhysicsWorld::reportDebugShapes() const {
+    if (!DebugDraw::isEnabled()) return;
+    for (const PhysicsBody* body : staticBodies) body->reportDebugShape();
+    for (const PhysicsBody* body : dynamicBodies) body->reportDebugShape();
+}
+
 void PhysicsWorld::update(float dt) {
     for (auto* body : dynamicBodies) {
         body->applyDamping(0.1f * dt);
@@ -73,47 +91,81 @@ void PhysicsWorld::update(float dt) {
     }
 }
 
+float PhysicsWorld::buildBroadphase() {
+    broadphase.clear();
+    float largest = 0.0f;
+    for (auto* b : dynamicBodies) {
+        // Skip dead entities
+        if (!b->owner || !b->owner->isAlive()) continue;
+        largest = std::max(largest, std::max(b->size.x, b->size.y));
+    }
+    // A power-of-two multiple of the Morton grid keeps the same Z-order, so reorderDynamicBodiesByMorton
+    // leaves dynamicBodies already sorted for this grid
+    float cell = gridCellSize;
+    while (cell < largest) cell *= 2.0f;
+
+    for (auto* b : dynamicBodies) {
+        if (!b->owner || !b->owner->isAlive()) continue;
+        uint32_t key = Morton::key(b->position.x, b->position.y, gridOriginX, gridOriginY, cell);
+        broadphase.push_back({ key, b->position.x, b->position.y, 0.5f * std::max(b->size.x, b->size.y), b });
+    }
+
+    // Insertion sort while the input is nearly ordered (Morton ordering on); give up after a linear
+    // budget of moves and fall back to a full sort (ordering off, or a burst of spawns)
+    auto byCell = [](const BroadphaseEntry& l, const BroadphaseEntry& r) { return l.cell < r.cell; };
+    size_t moves = 0;
+    const size_t budget = 4 * broadphase.size() + 64;
+    bool sorted = true;
+    for (size_t i = 1; i < broadphase.size() && sorted; ++i) {
+        if (broadphase[i - 1].cell <= broadphase[i].cell) continue;
+        BroadphaseEntry e = broadphase[i];
+        size_t j = i;
+        while (j > 0 && broadphase[j - 1].cell > e.cell) {
+            broadphase[j] = broadphase[j - 1];
+            --j;
+            if (++moves >= budget) { sorted = false; break; }
+        }
+        broadphase[j] = e;
+    }
+    if (!sorted) std::stable_sort(broadphase.begin(), broadphase.end(), byCell);
+    return cell;
+}
+
 void PhysicsWorld::resolveCollisions() {
     // reset collision counter
     lastCollisionChecks = 0;
 
-    for (auto* a : dynamicBodies) {
-        // Skip dead entities
+    // Dynamic pairs: every body is tested against the bodies in its own and the 8 surrounding cells
+    // (a cell is at least as large as any body, so overlapping bodies are always in adjacent cells)
+    const float cell = buildBroadphase();
+    const float maxCell = 65535.0f;
+    for (const BroadphaseEntry& ea : broadphase) {
+        PhysicsBody* a = ea.body;
         if (!a->owner || !a->owner->isAlive()) continue;
 
-        for (auto* b : dynamicBodies) {
-            if (a == b || !b->owner || !b->owner->isAlive()) continue;
-
-            // count this collision test
-            ++lastCollisionChecks;
-            if (isColliding(a, b)) {
-                if (!a->isTrigger && !b->isTrigger) {
-                    resolveDynamicCollision(*a, *b);
-                }
-                Entity* ea = a->owner;
-                Entity* eb = b->owner;
-
-                // Attempt to detect Bullet vs BaseZombie pair
-                // Use RTTI via dynamic_cast to avoid coupling headers here beyond forward declarations.
-                Bullet* bullet = dynamic_cast<Bullet*>(ea);
-                BaseZombie* zb = dynamic_cast<BaseZombie*>(eb);
-                if (!bullet || !zb) {
-                    bullet = dynamic_cast<Bullet*>(eb);
-                    zb = dynamic_cast<BaseZombie*>(ea);
+        const int cx = static_cast<int>(std::clamp((ea.x - gridOriginX) / cell, 0.0f, maxCell));
+        const int cy = static_cast<int>(std::clamp((ea.y - gridOriginY) / cell, 0.0f, maxCell));
+        for (int ny = std::max(cy - 1, 0); ny <= std::min(cy + 1, 65535); ++ny) {
+            for (int nx = std::max(cx - 1, 0); nx <= std::min(cx + 1, 65535); ++nx) {
+                const uint32_t key = Morton::encode(static_cast<uint32_t>(nx), static_cast<uint32_t>(ny));
+                auto first = std::lower_bound(broadphase.begin(), broadphase.end(), key,
+                    [](const BroadphaseEntry& e, uint32_t k) { return e.cell < k; });
+                for (auto it = first; it != broadphase.end() && it->cell == key; ++it) {
+                    const BroadphaseEntry& eb = *it;
+                    PhysicsBody* b = eb.body;
+                    if (a == b || !b->owner || !b->owner->isAlive()) continue;
+                    // cheap reject on the contiguous entries before touching the bodies
+                    const float reach = ea.halfExtent + eb.halfExtent;
+                    if (std::abs(ea.x - eb.x) > reach || std::abs(ea.y - eb.y) > reach) continue;
+                    resolveDynamicPair(a, b);
                 }
-
-                if (bullet && zb) {
-                    // Compute hit position and pass bullet velocity
-                    Vec2 hitPos = bullet->getBody().position;
-                    Vec2 bvel = bullet->getBody().velocity;
-                    int rem = bullet->getRemainingPenetrations();
-                    zb->onHitByBullet(hitPos, bvel, rem);
-                }
-
-                // Now perform existing collision callbacks for game logic
-                handleCollision(a->owner, b->owner);
             }
         }
+    }
+
+    for (auto* a : dynamicBodies) {
+        // Skip dead entities
+        if (!a->owner || !a->owner->isAlive()) continue;
 
         for (auto* s : staticBodies) {
             if (!s->owner || !s->owner->isAlive()) continue;
@@ -129,6 +181,38 @@ void PhysicsWorld::resolveCollisions() {
     }
 }
 
+void PhysicsWorld::resolveDynamicPair(PhysicsBody* a, PhysicsBody* b) {
+    // count this collision test
+    ++lastCollisionChecks;
+    if (!isColliding(a, b)) return;
+
+    if (!a->isTrigger && !b->isTrigger) {
+        resolveDynamicCollision(*a, *b);
+    }
+    Entity* ea = a->owner;
+    Entity* eb = b->owner;
+
+    // Attempt to detect Bullet vs BaseZombie pair
+    // Use RTTI via dynamic_cast to avoid coupling headers here beyond forward declarations.
+    Bullet* bullet = dynamic_cast<Bullet*>(ea);
+    BaseZombie* zb = dynamic_cast<BaseZombie*>(eb);
+    if (!bullet || !zb) {
+        bullet = dynamic_cast<Bullet*>(eb);
+        zb = dynamic_cast<BaseZombie*>(ea);
+    }
+
+    if (bullet && zb) {
+        // Compute hit position and pass bullet velocity
+        Vec2 hitPos = bullet->getBody().position;
+        Vec2 bvel = bullet->getBody().velocity;
+        int rem = bullet->getRemainingPenetrations();
+        zb->onHitByBullet(hitPos, bvel, rem);
+    }
+
+    // Now perform existing collision callbacks for game logic
+    handleCollision(a->owner, b->owner);
+}
+
 bool PhysicsWorld::isColliding(PhysicsBody* a, PhysicsBody* b) {
     if (a->isCircle && b->isCircle)
         return isCircleCircle(a, b);
@@ -1,5 +1,10 @@
 #include "Player.h"
 #include "Bullet.h"
+#include "DebugDraw.h"
+#include "GameRandom.h"
+#include "NoiseField.h"
+#include "RenderQueue.h"
+#include "ShadowBarRenderer.h"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
@@ -212,9 +217,6 @@ void Player::updateAnimation(float deltaTime) {
 
 // update() uses setFeetStateInternal to switch feet animations based on movement
 void Player::update(float deltaTime, sf::RenderWindow& window, sf::Vector2u mapSize, sf::Vector2f worldMousePosition) {
-    // at top of update store previous pos
-    prevPos = currPos;
-
     // Decay debug muzzle markers here rather than in render() so lifetime is frame-rate independent
     if (!g_recentMuzzles.empty()) {
         for (auto it = g_recentMuzzles.begin(); it != g_recentMuzzles.end(); ) {
@@ -239,10 +241,10 @@ void Player::update(float deltaTime, sf::RenderWindow& window, sf::Vector2u mapS
     }
 
     // Input (movement keys are still read here; sprint/aim intent comes from Game via public API)
-    bool left = sf::Keyboard::isKeyPressed(sf::Keyboard::A);
-    bool right = sf::Keyboard::isKeyPressed(sf::Keyboard::D);
-    bool up = sf::Keyboard::isKeyPressed(sf::Keyboard::W);
-    bool down = sf::Keyboard::isKeyPressed(sf::Keyboard::S);
+    bool left = keyboardEnabled && sf::Keyboard::isKeyPressed(sf::Keyboard::A);
+    bool right = keyboardEnabled && sf::Keyboard::isKeyPressed(sf::Keyboard::D);
+    bool up = keyboardEnabled && sf::Keyboard::isKeyPressed(sf::Keyboard::W);
+    bool down = keyboardEnabled && sf::Keyboard::isKeyPressed(sf::Keyboard::S);
     // 'desiredSprint' and 'aiming' are set externally by Game
 
     // Build movement vector relative to world
@@ -484,7 +486,7 @@ void Player::update(float deltaTime, sf::RenderWindow& window, sf::Vector2u mapS
     }
     body.position += body.velocity * deltaTime;
     // do not directly sync sprite here; store current position for interpolation
-    currPos = sf::Vector2f(body.position.x, body.position.y);
+    transform.setCurrent(sf::Vector2f(body.position.x, body.position.y));
 
     // Decay knockback timer
     if (knockbackTimer > 0.0f) {
@@ -515,28 +517,8 @@ void Player::update(float deltaTime, sf::RenderWindow& window, sf::Vector2u mapS
         }
     }
 
-    // Update active muzzle flashes (decay by real deltaTime so visibility is frame-rate independent)
-    if (!activeMuzzles.empty()) {
-        for (auto it = activeMuzzles.begin(); it != activeMuzzles.end(); ) {
-            it->life -= deltaTime;
-            if (it->life <= 0.0f) {
-                it = activeMuzzles.erase(it);
-            } else {
-                // Compute elapsed fraction (0..1)
-                float t = it->life / it->maxLife; // remaining fraction
-                float elapsed = 1.0f - t; // 0..1
-                // alpha follows sin(pi * elapsed): fades in then out
-                float alphaFactor = std::sin(3.14159265f * elapsed);
-                if (alphaFactor < 0.0f) alphaFactor = 0.0f;
-                sf::Uint8 alpha = static_cast<sf::Uint8>(255.0f * alphaFactor);
-                it->sprite.setColor(sf::Color(255,255,255, alpha));
-                // Slight scale change tied to alpha for a pop effect
-                float s = muzzleFlashScale * (0.6f + 0.4f * alphaFactor);
-                it->sprite.setScale(s, s);
-                ++it;
-            }
-        }
-    }
+    // Age muzzle flashes and tracers by the step so their lifetime is frame-rate independent
+    muzzleEffects.update(deltaTime);
 }
 
 void Player::shoot(const sf::Vector2f& target, PhysicsWorld& physicsWorld, std::vector<std::unique_ptr<Bullet>>& bullets) {
@@ -607,7 +589,7 @@ void Player::shoot(const sf::Vector2f& target, PhysicsWorld& physicsWorld, std::
     sf::Vector2f aimDir = (aimLen > 1e-6f) ? sf::Vector2f(aimVec.x/aimLen, aimVec.y/aimLen) : spriteFacing;
 
     // RNG
-    static thread_local std::mt19937 gen((unsigned)std::random_device{}());
+    std::mt19937& gen = GameRandom::engine();
 
     // Visual params
     sf::Vector2f spriteOffset(0.f, 0.f);
@@ -631,9 +613,16 @@ void Player::shoot(const sf::Vector2f& target, PhysicsWorld& physicsWorld, std::
                                                spriteOffset, spriteScale, spriteRotationOffset);
         physicsWorld.addBody(&bullet->getBody(), false);
         bullets.push_back(std::move(bullet));
+        muzzleEffects.emitTracer(spawnPos, vel, tracerLife, tracerLength, tracerWidth);
         currentAmmo = std::max(0, currentAmmo - 1);
     }
 
+    // Make noise at the muzzle
+    if (noiseField) {
+        float radius = (currentWeapon == WeaponType::RIFLE) ? shotNoiseRadiusRifle : shotNoiseRadiusPistol;
+        noiseField->emit(spawnPos, shotNoiseLoudness, radius);
+    }
+
     // Recoil
     if (aiming) recoil = std::min(maxRecoilAimed, recoil + recoilPerShotAimed);
     else recoil = std::min(maxRecoilHip, recoil + recoilPerShotHip);
@@ -682,22 +671,13 @@ void Player::shoot(const sf::Vector2f& target, PhysicsWorld& physicsWorld, std::
 
     // Muzzle flash
     if (muzzleTexture) {
-        Player::MuzzleFlash mf;
-        mf.maxLife = muzzleFlashLife;
-        mf.life = mf.maxLife;
-        mf.sprite.setTexture(*muzzleTexture);
         float forwardOffset = 6.0f;
         sf::Vector2f face(std::cos(spriteRotRad), std::sin(spriteRotRad));
         sf::Vector2f pos = spawnPos + face * forwardOffset;
-        mf.sprite.setOrigin(muzzleTexture->getSize().x * 0.5f, muzzleTexture->getSize().y * 0.5f);
-        mf.sprite.setPosition(pos);
         float baseRot = spriteRotDeg + muzzleFlashRotationOffset;
-        static thread_local std::mt19937 rg((unsigned)std::random_device{}());
         std::uniform_real_distribution<float> jitterDist(-muzzleFlashRotationJitterDeg, muzzleFlashRotationJitterDeg);
-        float jitter = jitterDist(rg);
-        mf.sprite.setRotation(baseRot + jitter);
-        mf.sprite.setScale(muzzleFlashScale, muzzleFlashScale);
-        activeMuzzles.push_back(std::move(mf));
+        float jitter = jitterDist(GameRandom::engine());
+        muzzleEffects.emitFlash(pos, baseRot + jitter, muzzleFlashScale, muzzleFlashLife);
     }
 }
 
@@ -779,7 +759,7 @@ void Player::sprint(bool isSprinting) {
 }
 
 void Player::takeDamage(float amount) {
-    if (dead) return;
+    if (dead || invulnerable) return;
     health -= amount;
     timeSinceLastDamage = 0.0f;
     if (health <= 0.0f) {
@@ -793,7 +773,7 @@ void Player::setPosition(float x, float y) {
     body.position.y = y;
     sprite.setPosition(x, y);
     feetSprite.setPosition(x, y + 8.0f);
-    prevPos = currPos = sf::Vector2f(x, y);
+    transform.teleport(sf::Vector2f(x, y));
 }
 
 sf::Vector2f Player::getPosition() const {
@@ -884,11 +864,6 @@ void Player::applyKnockback(const sf::Vector2f& direction, float force) {
     knockbackTimer = knockbackDuration;
 }
 
-void Player::draw(sf::RenderWindow& window) {
-    // For compatibility: draw is same as render here
-    render(window);
-}
-
 void Player::reset() {
     health = maxHealth;
     stamina = maxStamina;
@@ -917,7 +892,7 @@ void Player::reset() {
     if (currentWeapon == WeaponType::PISTOL) currentAmmo = std::clamp(pistolAmmoInMag, 0, magazineSize);
     else if (currentWeapon == WeaponType::RIFLE) currentAmmo = std::clamp(rifleAmmoInMag, 0, magazineSize);
     // clear muzzle flashes
-    activeMuzzles.clear();
+    muzzleEffects.clearFlashes();
     syncSpriteWithBody();
 }
 
@@ -956,124 +931,66 @@ void Player::setWeapon(WeaponType weapon) {
     }
 }
 
-void Player::render(sf::RenderWindow& window) {
+void Player::drawShadow(ShadowBarRenderer& overlays) const {
+    if (!isAlive() || !shadowTexture) return;
+    sf::Vector2f interp = transform.getInterpolated();
+    // slightly below feet; darker than the zombies' shadows
+    overlays.addShadow(sf::Vector2f(interp.x, interp.y + 12.0f), 1.0f, sf::Color(0,0,0,220));
+}
+
+void Player::render(RenderQueue& queue) {
     // If the entity was destroyed (owner cleared), skip rendering completely
     if (!isAlive()) return;
-    // interpolate position
-    sf::Vector2f interp = prevPos + (currPos - prevPos) * renderAlpha;
+    sf::Vector2f interp = transform.getInterpolated();
     sprite.setPosition(interp.x, interp.y);
     feetSprite.setPosition(interp.x + feetOffsetX, interp.y + feetOffsetY);
 
-    // draw feet first so torso renders over them
-    window.draw(feetSprite);
-    window.draw(sprite);
-
-    // Draw muzzle flashes (use additive blending)
-    if (!activeMuzzles.empty()) {
-        sf::RenderStates rs;
-        rs.blendMode = sf::BlendAdd;
-        for (auto it = activeMuzzles.begin(); it != activeMuzzles.end(); ) {
-            float t = it->life / it->maxLife;
-            sf::Color c = sf::Color(255, 255, 255, static_cast<sf::Uint8>(255 * t));
-            it->sprite.setColor(c);
-            window.draw(it->sprite, rs);
-            // decay (we now decrement in update(), keep this as a safer fallback but much smaller)
-            it->life -= 1.0f/60.0f;
-            if (it->life <= 0.0f) it = activeMuzzles.erase(it);
-            else ++it;
-        }
-    }
+    // feet and torso move with the player
+    queue.setMotion(transform.getMotion());
+    queue.submitSprite(RenderLayer::Player, feetSprite);
+    queue.submitSprite(RenderLayer::Player, sprite);
+    queue.setMotion(sf::Vector2f());
+    // flashes stay where they were fired; tracers are placed at the frame's alpha by the emitter
+    muzzleEffects.submit(queue, TransformBuffer::instance().getAlpha());
+}
 
-    // draw shadow under the player if available
-    if (shadowTexture) {
-        sf::Sprite sh;
-        sh.setTexture(*shadowTexture);
-        // position slightly below feet
-        float shadowScale = 1.0f;
-        sh.setOrigin(shadowTexture->getSize().x * 0.5f, shadowTexture->getSize().y * 0.5f);
-        sh.setPosition(interp.x, interp.y + 12.0f);
-        sh.setScale(shadowScale, shadowScale);
-        // DARKER SHADOW: increased alpha for a stronger, darker shadow
-        sh.setColor(sf::Color(0,0,0,220));
-        window.draw(sh);
-    }
+void Player::reportDebugShapes() const {
+    if (!DebugDraw::isEnabled()) return;
+    // Upper and feet sprite origins, hitbox
+    DebugDraw::circle(sprite.getPosition(), 4.0f, sf::Color::Red, 8);
+    DebugDraw::circle(feetSprite.getPosition(), 4.0f, sf::Color::Green, 8);
+    DebugDraw::rect(getHitbox(), sf::Color(0, 255, 0));
 
-    if (debugDrawOrigins) {
-        sf::CircleShape upperMarker(4.0f);
-        upperMarker.setFillColor(sf::Color::Red);
-        sf::Vector2f upperPos = sprite.getPosition();
-        upperMarker.setPosition(upperPos.x - upperMarker.getRadius(), upperPos.y - upperMarker.getRadius());
-        window.draw(upperMarker);
-
-        sf::CircleShape feetMarker(4.0f);
-        feetMarker.setFillColor(sf::Color::Green);
-        sf::Vector2f feetPos = feetSprite.getPosition();
-        feetMarker.setPosition(feetPos.x - feetMarker.getRadius(), feetPos.y - feetMarker.getRadius());
-        window.draw(feetMarker);
-
-        // Draw recent muzzle spawn markers (frame-rate independent decay handled in update)
-        for (const auto &m : g_recentMuzzles) {
-            sf::CircleShape s(3.0f);
-            s.setFillColor(sf::Color(255, 0, 255, 200));
-            s.setPosition(m.first.x - s.getRadius(), m.first.y - s.getRadius());
-            window.draw(s);
-        }
+    // Recent muzzle spawn markers (frame-rate independent decay handled in update)
+    for (const auto &m : g_recentMuzzles) DebugDraw::circle(m.first, 3.0f, sf::Color(255, 0, 255, 200), 8);
 
-        // Draw debug line projecting out from the muzzle position in the sprite facing direction
-        {
-            sf::Vector2f muzzlePos = getMuzzlePosition(sprite.getPosition());
-            float rotDeg = sprite.getRotation();
-            float rotRad = rotDeg * 3.14159265f / 180.0f;
-            sf::Vector2f dir(std::cos(rotRad), std::sin(rotRad));
-            float lineLen = 200.0f;
-            sf::Vertex line[2] = {
-                sf::Vertex(muzzlePos, sf::Color(255, 0, 255, 200)),
-                sf::Vertex(sf::Vector2f(muzzlePos.x + dir.x * lineLen, muzzlePos.y + dir.y * lineLen), sf::Color(255, 0, 255, 120))
-            };
-            window.draw(line, 2, sf::Lines);
-        }
-
-        // Debug: draw accuracy/spread cone for current weapon (base inaccuracy + recoil)
-        {
-            // compute inaccuracy degrees same as used in shoot()
-            float inaccuracyDeg = recoil; // recoil already applied elsewhere
-            if (currentWeapon == WeaponType::PISTOL) {
-                inaccuracyDeg += (aiming ? baseInaccuracyAimedPistol : baseInaccuracyHipPistol);
-            } else if (currentWeapon == WeaponType::RIFLE) {
-                inaccuracyDeg += (aiming ? baseInaccuracyAimedRifle : baseInaccuracyHipRifle);
-            }
+    // Line projecting out from the muzzle position in the sprite facing direction
+    sf::Vector2f muzzlePos = getMuzzlePosition(sprite.getPosition());
+    float baseRad = sprite.getRotation() * 3.14159265f / 180.0f;
+    sf::Vector2f dir(std::cos(baseRad), std::sin(baseRad));
+    DebugDraw::line(muzzlePos, muzzlePos + dir * 200.0f, sf::Color(255, 0, 255, 200));
 
-            // skip if no meaningful spread
-            if (inaccuracyDeg > 0.0001f) {
-                sf::Vector2f muzzlePos = getMuzzlePosition(sprite.getPosition());
-                float baseDeg = sprite.getRotation();
-                float baseRad = baseDeg * 3.14159265f / 180.0f;
-                float spreadRad = inaccuracyDeg * 3.14159265f / 180.0f;
-
-                // visual distance for cone
-                float coneLen = 400.0f;
-                const int segments = 32;
-                sf::Color coneColor(255, 200, 0, 64); // translucent yellow
-                sf::VertexArray fan(sf::TriangleFan);
-                fan.append(sf::Vertex(muzzlePos, coneColor));
-                for (int i = 0; i <= segments; ++i) {
-                    float t = (float)i / (float)segments;
-                    float ang = baseRad - spreadRad + t * (2.0f * spreadRad);
-                    sf::Vector2f p(muzzlePos.x + std::cos(ang) * coneLen, muzzlePos.y + std::sin(ang) * coneLen);
-                    fan.append(sf::Vertex(p, coneColor));
-                }
-                window.draw(fan);
-
-                // boundary lines
-                sf::Color lineC(255, 200, 0, 200);
-                sf::Vector2f leftP(muzzlePos.x + std::cos(baseRad - spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad - spreadRad) * coneLen);
-                sf::Vector2f rightP(muzzlePos.x + std::cos(baseRad + spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad + spreadRad) * coneLen);
-                sf::Vertex bl[2] = { sf::Vertex(muzzlePos, lineC), sf::Vertex(leftP, lineC) };
-                sf::Vertex br[2] = { sf::Vertex(muzzlePos, lineC), sf::Vertex(rightP, lineC) };
-                window.draw(bl, 2, sf::Lines);
-                window.draw(br, 2, sf::Lines);
-            }
+    // Accuracy/spread outline for the current weapon (base inaccuracy + recoil, same as shoot())
+    float inaccuracyDeg = recoil;
+    if (currentWeapon == WeaponType::PISTOL) {
+        inaccuracyDeg += (aiming ? baseInaccuracyAimedPistol : baseInaccuracyHipPistol);
+    } else if (currentWeapon == WeaponType::RIFLE) {
+        inaccuracyDeg += (aiming ? baseInaccuracyAimedRifle : baseInaccuracyHipRifle);
+    }
+    if (inaccuracyDeg > 0.0001f) {
+        float spreadRad = inaccuracyDeg * 3.14159265f / 180.0f;
+        const float coneLen = 400.0f;
+        const int segments = 16;
+        sf::Color lineC(255, 200, 0, 200);
+        sf::Vector2f prev(muzzlePos.x + std::cos(baseRad - spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad - spreadRad) * coneLen);
+        DebugDraw::line(muzzlePos, prev, lineC);
+        for (int i = 1; i <= segments; ++i) {
+            float ang = baseRad - spreadRad + (2.0f * spreadRad) * i / segments;
+            sf::Vector2f p(muzzlePos.x + std::cos(ang) * coneLen, muzzlePos.y + std::sin(ang) * coneLen);
+            DebugDraw::line(prev, p, lineC);
+            prev = p;
         }
+        DebugDraw::line(muzzlePos, prev, lineC);
     }
 }
 
@@ -1105,7 +1022,7 @@ bool Player::isDead() const {
 void Player::syncSpriteWithBody() {
     sprite.setPosition(body.position.x, body.position.y);
     feetSprite.setPosition(body.position.x + feetOffsetX, body.position.y + feetOffsetY);
-    prevPos = currPos = sf::Vector2f(body.position.x, body.position.y);
+    transform.teleport(sf::Vector2f(body.position.x, body.position.y));
 }
 
 void Player::loadTextures() {
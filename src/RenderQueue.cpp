@@ -0,0 +1,174 @@
+#include "RenderQueue.h"
+#include <array>
+#include <cassert>
+#include <cmath>
+
+namespace {
+    // Layers whose items may be regrouped by blend mode and texture for batching
+    bool layerBatchesByTexture(RenderLayer layer) {
+        switch (layer) {
+        case RenderLayer::Map:
+        case RenderLayer::Shadows:
+        case RenderLayer::HealthBars:
+        case RenderLayer::Bullets:
+        case RenderLayer::ZombieFlashes: // additive: order-independent
+        case RenderLayer::MuzzleEffects: // additive: order-independent
+            return true;
+        default:
+            return false;
+        }
+    }
+}
+
+void RenderQueue::clear() {
+    items.clear();
+    keys.clear();
+    vertices.clear();
+    commands.clear();
+    // Ids are per frame: a texture freed at a level change must not lend its id to a new one at the same address
+    textureIds.clear();
+    currentMotion = sf::Vector2f();
+}
+
+uint8_t RenderQueue::blendIdOf(const sf::BlendMode& blend) {
+    for (size_t i = 0; i < blendModes.size(); ++i) {
+        if (blendModes[i] == blend) return static_cast<uint8_t>(i);
+    }
+    // 4 bits in the key; the game only uses alpha and additive blending
+    assert(blendModes.size() < 16 && "RenderQueue supports at most 16 blend modes");
+    if (blendModes.size() >= 16) return 0;
+    blendModes.push_back(blend);
+    return static_cast<uint8_t>(blendModes.size() - 1);
+}
+
+uint64_t RenderQueue::makeKey(RenderLayer layer, uint8_t blendId, const sf::Texture* texture, uint32_t depth) {
+    // Painter's-order layers sort by depth alone; the stable sort keeps submission order among equals
+    if (!layerBatchesByTexture(layer)) return (static_cast<uint64_t>(layer) << 56) | depth;
+
+    uint32_t texId = 0; // untextured / commands
+    if (texture) {
+        auto it = textureIds.find(texture);
+        if (it == textureIds.end()) it = textureIds.emplace(texture, static_cast<uint32_t>(textureIds.size() + 1) & 0xFFFFF).first;
+        texId = it->second;
+    }
+    return (static_cast<uint64_t>(layer) << 56) | (static_cast<uint64_t>(blendId & 0xF) << 52)
+         | (static_cast<uint64_t>(texId) << 32) | depth;
+}
+
+void RenderQueue::submitQuads(RenderLayer layer, const sf::Texture* texture, const sf::BlendMode& blend,
+                              const sf::Vertex* v, size_t vertexCount, uint32_t depth) {
+    if (vertexCount == 0) return;
+    uint8_t blendId = blendIdOf(blend);
+    items.push_back({ static_cast<uint32_t>(vertices.size()), static_cast<uint32_t>(vertexCount), texture, blendId, currentMotion });
+    keys.push_back(makeKey(layer, blendId, texture, depth));
+    vertices.insert(vertices.end(), v, v + vertexCount);
+}
+
+void RenderQueue::submitSprite(RenderLayer layer, const sf::Sprite& sprite, const sf::BlendMode& blend, uint32_t depth) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    // Same corners and texture coordinates sf::Sprite builds (negative rect sizes flip the image)
+    const sf::IntRect r = sprite.getTextureRect();
+    const float w = static_cast<float>(std::abs(r.width));
+    const float h = static_cast<float>(std::abs(r.height));
+    const float u0 = static_cast<float>(r.left), u1 = u0 + r.width;
+    const float v0 = static_cast<float>(r.top), v1 = v0 + r.height;
+    const sf::Transform& t = sprite.getTransform();
+    const sf::Color c = sprite.getColor();
+
+    const sf::Vertex quad[4] = {
+        sf::Vertex(t.transformPoint(0.f, 0.f), c, sf::Vector2f(u0, v0)),
+        sf::Vertex(t.transformPoint(w, 0.f), c, sf::Vector2f(u1, v0)),
+        sf::Vertex(t.transformPoint(w, h), c, sf::Vector2f(u1, v1)),
+        sf::Vertex(t.transformPoint(0.f, h), c, sf::Vector2f(u0, v1))
+    };
+    submitQuads(layer, texture, blend, quad, 4, depth);
+}
+
+void RenderQueue::submitCommand(RenderLayer layer, Command command, uint32_t depth) {
+    items.push_back({ static_cast<uint32_t>(commands.size()), 0, nullptr, 0, sf::Vector2f() });
+    keys.push_back(makeKey(layer, 0, nullptr, depth));
+    commands.push_back(std::move(command));
+}
+
+void RenderQueue::interpolate(float alpha) {
+    const float back = 1.0f - alpha;
+    for (const Item& item : items) {
+        if (item.count == 0 || (item.motion.x == 0.f && item.motion.y == 0.f)) continue;
+        const sf::Vector2f offset = item.motion * back;
+        for (uint32_t i = item.first; i < item.first + item.count; ++i) vertices[i].position -= offset;
+    }
+}
+
+void RenderQueue::sortByKey() {
+    const size_t n = keys.size();
+    order.resize(n);
+    orderScratch.resize(n);
+    for (size_t i = 0; i < n; ++i) order[i] = static_cast<uint32_t>(i);
+
+    // LSD radix sort, 8 bits per pass; passes where every key has the same byte are skipped
+    // (depth is usually 0 and there are few layers/textures, so most frames need 2-3 passes)
+    std::array<uint32_t, 256> counts;
+    for (int shift = 0; shift < 64; shift += 8) {
+        counts.fill(0);
+        for (size_t i = 0; i < n; ++i) counts[(keys[i] >> shift) & 0xFF]++;
+        if (counts[(keys[0] >> shift) & 0xFF] == n) continue;
+
+        uint32_t sum = 0;
+        for (uint32_t& c : counts) { uint32_t tmp = c; c = sum; sum += tmp; }
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t idx = order[i];
+            orderScratch[counts[(keys[idx] >> shift) & 0xFF]++] = idx;
+        }
+        order.swap(orderScratch);
+    }
+}
+
+void RenderQueue::flush(sf::RenderTarget& target) {
+    lastItemCount = items.size();
+    lastDrawCalls = 0;
+    if (items.empty()) return;
+
+    sortByKey();
+
+    InstrumentedTarget out(target, RenderPass::World);
+    const size_t n = order.size();
+    for (size_t i = 0; i < n;) {
+        const Item& item = items[order[i]];
+        if (item.count == 0) {
+            commands[item.first](out);
+            ++lastDrawCalls;
+            ++i;
+            continue;
+        }
+
+        // Extend the run while the next item is a compatible quad item
+        size_t end = i + 1;
+        size_t runVertices = item.count;
+        while (end < n) {
+            const Item& next = items[order[end]];
+            if (next.count == 0 || next.texture != item.texture || next.blendId != item.blendId) break;
+            runVertices += next.count;
+            ++end;
+        }
+
+        sf::RenderStates states(blendModes[item.blendId]);
+        states.texture = item.texture;
+        if (end == i + 1) {
+            out.draw(&vertices[item.first], item.count, sf::Quads, states);
+        } else {
+            mergeBuffer.clear();
+            mergeBuffer.reserve(runVertices);
+            for (size_t k = i; k < end; ++k) {
+                const Item& it = items[order[k]];
+                mergeBuffer.insert(mergeBuffer.end(), vertices.begin() + it.first, vertices.begin() + it.first + it.count);
+            }
+            out.draw(mergeBuffer.data(), mergeBuffer.size(), sf::Quads, states);
+        }
+        ++lastDrawCalls;
+        i = end;
+    }
+
+    clear();
+}
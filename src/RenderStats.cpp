@@ -0,0 +1,94 @@
+#include "RenderStats.h"
+#include "SdfFont.h"
+
+RenderStats& RenderStats::instance() {
+    static RenderStats stats;
+    return stats;
+}
+
+void RenderStats::add(RenderPass pass, const DrawCounters& counters) {
+    std::lock_guard<std::mutex> lock(mutex);
+    DrawCounters& c = current[static_cast<size_t>(pass)];
+    c.draws += counters.draws;
+    c.vertices += counters.vertices;
+    c.textureChanges += counters.textureChanges;
+    c.blendChanges += counters.blendChanges;
+}
+
+void RenderStats::endFrame() {
+    std::lock_guard<std::mutex> lock(mutex);
+    const double smooth = 0.1;
+    for (size_t i = 0; i < kPassCount; ++i) {
+        lastFrame[i] = current[i];
+        current[i] = DrawCounters();
+        Averages& a = average[i];
+        a.draws += (lastFrame[i].draws - a.draws) * smooth;
+        a.vertices += (lastFrame[i].vertices - a.vertices) * smooth;
+        a.textureChanges += (lastFrame[i].textureChanges - a.textureChanges) * smooth;
+        a.blendChanges += (lastFrame[i].blendChanges - a.blendChanges) * smooth;
+    }
+}
+
+const char* RenderStats::getName(RenderPass pass) {
+    switch (pass) {
+        case RenderPass::World: return "world";
+        case RenderPass::Hud: return "hud";
+        case RenderPass::Menus: return "menus";
+        case RenderPass::Cutscene: return "cutscene";
+        default: return "?";
+    }
+}
+
+InstrumentedTarget::InstrumentedTarget(sf::RenderTarget& target, RenderPass pass)
+    : target(target), pass(pass) {}
+
+InstrumentedTarget::~InstrumentedTarget() {
+    if (counters.draws > 0) RenderStats::instance().add(pass, counters);
+}
+
+void InstrumentedTarget::count(std::size_t vertexCount, const sf::Texture* texture, const sf::BlendMode& blend) {
+    ++counters.draws;
+    counters.vertices += static_cast<uint32_t>(vertexCount);
+    if (!hasState || texture != lastTexture) ++counters.textureChanges;
+    if (!hasState || !(blend == lastBlend)) ++counters.blendChanges;
+    hasState = true;
+    lastTexture = texture;
+    lastBlend = blend;
+}
+
+void InstrumentedTarget::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    target.draw(drawable, states);
+
+    // sf::Drawable hides its geometry; count the types the game draws the way SFML submits them
+    if (auto* sprite = dynamic_cast<const sf::Sprite*>(&drawable)) {
+        count(4, sprite->getTexture(), states.blendMode);
+    } else if (auto* shape = dynamic_cast<const sf::Shape*>(&drawable)) {
+        // fill is a fan (centre + points + closing point); the outline is a separate untextured strip
+        count(shape->getPointCount() + 2, shape->getTexture(), states.blendMode);
+        if (shape->getOutlineThickness() != 0.f) count((shape->getPointCount() + 1) * 2, nullptr, states.blendMode);
+    } else if (auto* text = dynamic_cast<const sf::Text*>(&drawable)) {
+        // two triangles per character (an estimate: whitespace has no quad); outline is a second draw
+        const sf::Font* font = text->getFont();
+        const sf::Texture* glyphs = font ? &font->getTexture(text->getCharacterSize()) : nullptr;
+        const std::size_t vertices = text->getString().getSize() * 6;
+        if (text->getOutlineThickness() != 0.f) count(vertices, glyphs, states.blendMode);
+        count(vertices, glyphs, states.blendMode);
+    } else if (auto* sdf = dynamic_cast<const SdfText*>(&drawable)) {
+        count(sdf->getVertexCount(), sdf->getTexture(), states.blendMode);
+    } else if (auto* array = dynamic_cast<const sf::VertexArray*>(&drawable)) {
+        count(array->getVertexCount(), states.texture, states.blendMode);
+    } else {
+        count(0, states.texture, states.blendMode);
+    }
+}
+
+void InstrumentedTarget::draw(const sf::VertexBuffer& buffer, const sf::RenderStates& states) {
+    target.draw(buffer, states);
+    count(buffer.getVertexCount(), states.texture, states.blendMode);
+}
+
+void InstrumentedTarget::draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                              const sf::RenderStates& states) {
+    target.draw(vertices, vertexCount, type, states);
+    count(vertexCount, states.texture, states.blendMode);
+}
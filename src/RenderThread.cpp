@@ -0,0 +1,115 @@
+#include "RenderThread.h"
+#include <iostream>
+#include <utility>
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+bool RenderThread::start(const sf::Vector2u& size) {
+    if (isRunning()) return true;
+    for (sf::RenderTexture& target : targets) {
+        if (!target.create(size.x, size.y)) {
+            std::cerr << "Error creating render thread target (" << size.x << "x" << size.y << ")" << std::endl;
+            return false;
+        }
+        target.setSmooth(true); // upscaled when dynamic resolution lowers the world scale
+        target.clear(sf::Color::Black);
+        target.display();
+        // Release the context here so the render thread can make it current
+        target.setActive(false);
+    }
+    front = 0;
+    hasPublished = false;
+    quit = false;
+    requested = false;
+    busy = false;
+    frameInFlight = false;
+    thread = std::thread(&RenderThread::threadMain, this);
+    return true;
+}
+
+void RenderThread::stop() {
+    if (!isRunning()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    wake.notify_one();
+    thread.join();
+}
+
+void RenderThread::publish(const sf::View& view) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::swap(recording, published);
+        publishedView = view;
+        hasPublished = true;
+    }
+    recording.clear();
+}
+
+const sf::Texture& RenderThread::exchange(float alpha) {
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return !busy; });
+    // The frame started last time is done: it becomes the one the main thread shows
+    if (frameInFlight) {
+        front = 1 - front;
+        shownItemCount = renderedItemCount;
+        shownDrawCalls = renderedDrawCalls;
+        shownViewport = renderedViewport;
+    }
+
+    // Nothing new to draw: keep showing the last texture (the working queue is consumed by its flush)
+    if (!hasPublished) {
+        frameInFlight = false;
+        return targets[front].getTexture();
+    }
+    requestedAlpha = alpha;
+    requested = true;
+    busy = true;
+    frameInFlight = true;
+    lock.unlock();
+    wake.notify_one();
+    return targets[front].getTexture();
+}
+
+void RenderThread::threadMain() {
+    for (;;) {
+        sf::View view;
+        float alpha = 1.0f;
+        int backIndex = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return quit || requested; });
+            if (quit) break;
+            requested = false;
+            // Take the snapshot so the simulation can publish the next one while it is drawn. The spare
+            // left in published goes back to recording on the next publish, which clears it.
+            std::swap(working, published);
+            hasPublished = false;
+            view = publishedView;
+            alpha = requestedAlpha;
+            backIndex = 1 - front;
+        }
+
+        sf::RenderTexture& target = targets[backIndex];
+        target.setActive(true);
+        target.clear(sf::Color::Black);
+        target.setView(view);
+        working.interpolate(alpha);
+        working.flush(target);
+        target.display();
+        // Deactivating flushes the context, so the main thread samples a finished texture
+        target.setActive(false);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            renderedItemCount = working.getLastItemCount();
+            renderedDrawCalls = working.getLastDrawCalls();
+            renderedViewport = view.getViewport();
+            busy = false;
+        }
+        finished.notify_one();
+    }
+}
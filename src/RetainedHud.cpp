@@ -0,0 +1,263 @@
+#include "RetainedHud.h"
+#include "RenderStats.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace {
+    // Bars (bottom-left)
+    const float kBarWidth = 340.f;
+    const float kBarHeight = 10.f;
+    const float kBarPadding = 20.f;
+    const float kBarSpacing = 8.f;
+    const float kContainerPad = 10.f;
+    // Vertical raise for HUD elements (positive moves them upward)
+    const float kVerticalRaise = 20.f;
+    // Weapon panels (bottom-right)
+    const float kPanelWidth = 240.f;
+    const float kPanelHeight = 64.f;
+    const float kPanelPadding = 16.f; // distance from screen edges
+    const float kPanelGap = 5.f;      // space between stacked panels
+    const float kIconLineFrac = 0.55f;
+    const float kFrameWidth = 2.f;
+
+    // The layers hold premultiplied colors (transparent texture, alpha-blended draws)
+    const sf::BlendMode kPremultipliedAlpha(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+    void appendRect(sf::VertexArray& va, float x, float y, float w, float h, const sf::Color& color) {
+        va.append(sf::Vertex(sf::Vector2f(x, y), color));
+        va.append(sf::Vertex(sf::Vector2f(x + w, y), color));
+        va.append(sf::Vertex(sf::Vector2f(x + w, y + h), color));
+        va.append(sf::Vertex(sf::Vector2f(x, y + h), color));
+    }
+
+    // Fit an icon into the slot between the panel's left edge and lineX, times mul, centred
+    void placeIcon(sf::Sprite& s, const sf::Texture& tex, const sf::FloatRect& panel, float mul, float lineX) {
+        s.setTexture(tex, true);
+        float texW = static_cast<float>(tex.getSize().x);
+        float texH = static_cast<float>(tex.getSize().y);
+        const float pad = 2.0f;
+        float slotLeft = panel.left + pad;
+        float slotW = (lineX - pad) - slotLeft;
+        if (slotW < 8.f) slotW = std::max(8.f, panel.width - pad * 2.f);
+        float slotH = panel.height - pad * 2.0f;
+        float baseScale = 1.0f;
+        if (texW > 0 && texH > 0) baseScale = std::min(slotW / texW, slotH / texH);
+        float scale = baseScale * mul;
+        s.setScale(scale, scale);
+        s.setPosition(slotLeft + (slotW - texW * scale) * 0.5f, panel.top + pad + (slotH - texH * scale) * 0.5f);
+    }
+
+    // Ammo as two parts, current (white) and "/mag" (grey), right-aligned inside the panel
+    void placeAmmo(sf::Text& ammo, sf::Text& mag, const sf::Font& font, int ammoVal, int magVal, const sf::FloatRect& panel) {
+        unsigned int charSize = static_cast<unsigned int>(std::max(10.f, panel.height * 0.75f));
+        ammo.setFont(font);
+        mag.setFont(font);
+        ammo.setCharacterSize(charSize);
+        mag.setCharacterSize(charSize);
+        ammo.setFillColor(sf::Color::White);
+        mag.setFillColor(sf::Color(160, 160, 160));
+        ammo.setString(std::to_string(ammoVal));
+        mag.setString(std::string("/") + std::to_string(magVal));
+
+        sf::FloatRect lb = ammo.getLocalBounds();
+        sf::FloatRect rb = mag.getLocalBounds();
+        float totalW = (lb.width + lb.left) + (rb.width + rb.left);
+        float startX = panel.left + panel.width - 10.f - totalW; // 10px right padding
+        float y = panel.top + (panel.height - lb.height) * 0.5f - lb.top;
+        ammo.setPosition(startX - 4.f, y);
+        mag.setPosition(startX + (lb.width + lb.left), y);
+    }
+}
+
+bool HudResources::operator==(const HudResources& o) const {
+    return font == o.font && pistolIcon == o.pistolIcon && rifleIcon == o.rifleIcon
+        && keyIcon1 == o.keyIcon1 && keyIcon2 == o.keyIcon2
+        && pistolTopScale == o.pistolTopScale && pistolBottomScale == o.pistolBottomScale
+        && rifleTopScale == o.rifleTopScale && rifleBottomScale == o.rifleBottomScale;
+}
+
+void RetainedHud::rebuildLayout(const sf::Vector2u& windowSize) {
+    layoutSize = windowSize;
+    const float winW = static_cast<float>(windowSize.x);
+    const float winH = static_cast<float>(windowSize.y);
+
+    // Health and stamina bars, long and skinny, bottom-left
+    staminaY = winH - kBarHeight - kBarPadding - kVerticalRaise;
+    barPos = sf::Vector2f(kBarPadding, staminaY - kBarHeight - kBarSpacing);
+
+    // Container backdrop behind the bars: left-opaque -> right-transparent gradient
+    sf::FloatRect container(kBarPadding - kContainerPad, barPos.y - kContainerPad,
+                            kBarWidth + kContainerPad * 2.f, kBarHeight * 2.f + kBarSpacing + kContainerPad * 2.f);
+    const sf::Color opaqueCol(10, 10, 10, 100);
+    const sf::Color transparentCol(10, 10, 10, 0);
+    const float cr = container.left + container.width, cb = container.top + container.height;
+    barContainer[0] = sf::Vertex(sf::Vector2f(container.left, container.top), opaqueCol);
+    barContainer[1] = sf::Vertex(sf::Vector2f(container.left, cb), opaqueCol);
+    barContainer[2] = sf::Vertex(sf::Vector2f(cr, container.top), transparentCol);
+    barContainer[3] = sf::Vertex(sf::Vector2f(cr, container.top), transparentCol);
+    barContainer[4] = sf::Vertex(sf::Vector2f(container.left, cb), opaqueCol);
+    barContainer[5] = sf::Vertex(sf::Vector2f(cr, cb), transparentCol);
+
+    for (sf::RectangleShape* bg : { &healthBg, &staminaBg }) {
+        bg->setSize(sf::Vector2f(kBarWidth, kBarHeight));
+        bg->setFillColor(sf::Color(40, 40, 40, 200));
+        bg->setOutlineColor(sf::Color(100, 100, 100, 180));
+        bg->setOutlineThickness(1.f);
+    }
+    healthBg.setPosition(barPos);
+    staminaBg.setPosition(barPos.x, staminaY);
+    healthFill.setFillColor(sf::Color::Green);
+    healthFill.setPosition(barPos);
+    staminaFill.setFillColor(sf::Color::White);
+    staminaFill.setPosition(barPos.x, staminaY);
+    flashFill.setFillColor(sf::Color(200, 40, 40, 220));
+
+    // Two stacked dark panels bottom-right; the lower (holstered weapon) one is smaller
+    const float bottomW = kPanelWidth * 0.82f;
+    const float bottomH = kPanelHeight * 0.55f;
+    panelBottom = sf::FloatRect(winW - kPanelPadding - bottomW, winH - kPanelPadding - bottomH - kVerticalRaise, bottomW, bottomH);
+    panelTop = sf::FloatRect(winW - kPanelPadding - kPanelWidth, panelBottom.top - kPanelGap - kPanelHeight, kPanelWidth, kPanelHeight);
+    iconLineX = panelTop.left + kPanelWidth * kIconLineFrac;
+    panelTopShape.setSize(sf::Vector2f(panelTop.width, panelTop.height));
+    panelTopShape.setPosition(panelTop.left, panelTop.top);
+    panelTopShape.setFillColor(sf::Color(0, 0, 0, 160));
+    panelBottomShape.setSize(sf::Vector2f(panelBottom.width, panelBottom.height));
+    panelBottomShape.setPosition(panelBottom.left, panelBottom.top);
+    panelBottomShape.setFillColor(sf::Color(0, 0, 0, 160));
+
+    // Solid white side outlines on the top panel, with short brackets extending inward
+    panelFrame.clear();
+    const float horizLen = kPanelWidth * 0.03f;
+    const float right = panelTop.left + panelTop.width;
+    const float bottom = panelTop.top + panelTop.height;
+    appendRect(panelFrame, panelTop.left, panelTop.top, kFrameWidth, panelTop.height, sf::Color::White);
+    appendRect(panelFrame, right - kFrameWidth, panelTop.top, kFrameWidth, panelTop.height, sf::Color::White);
+    appendRect(panelFrame, panelTop.left + kFrameWidth, panelTop.top, horizLen, kFrameWidth, sf::Color::White);
+    appendRect(panelFrame, panelTop.left + kFrameWidth, bottom - kFrameWidth, horizLen, kFrameWidth, sf::Color::White);
+    appendRect(panelFrame, right - kFrameWidth - horizLen, panelTop.top, horizLen, kFrameWidth, sf::Color::White);
+    appendRect(panelFrame, right - kFrameWidth - horizLen, bottom - kFrameWidth, horizLen, kFrameWidth, sf::Color::White);
+
+    const sf::Drawable* bars[] = { &barContainer, &healthBg, &staminaBg };
+    renderLayer(barsLayer, container, bars, 3);
+    const float panelsLeft = std::min(panelTop.left, panelBottom.left);
+    const sf::FloatRect panels(panelsLeft, panelTop.top, winW - kPanelPadding - panelsLeft, panelBottom.top + panelBottom.height - panelTop.top);
+    const sf::Drawable* panelShapes[] = { &panelTopShape, &panelBottomShape };
+    renderLayer(panelsLayer, panels, panelShapes, 2);
+
+    layoutValid = true;
+    iconsValid = false;
+    ammoValid = false;
+    barsValid = false;
+}
+
+void RetainedHud::renderLayer(CachedLayer& layer, const sf::FloatRect& bounds, const sf::Drawable* const* drawables, size_t count) {
+    // Whole pixels so the cached texels land on screen pixels
+    const float left = std::floor(bounds.left), top = std::floor(bounds.top);
+    const unsigned w = static_cast<unsigned>(std::ceil(bounds.left + bounds.width) - left);
+    const unsigned h = static_cast<unsigned>(std::ceil(bounds.top + bounds.height) - top);
+    layer.bounds = sf::FloatRect(left, top, static_cast<float>(w), static_cast<float>(h));
+    layer.ready = false;
+    if (w == 0 || h == 0) return;
+    if (layer.texture.getSize() != sf::Vector2u(w, h) && !layer.texture.create(w, h)) return;
+
+    layer.texture.clear(sf::Color::Transparent);
+    layer.texture.setView(sf::View(layer.bounds));
+    for (size_t i = 0; i < count; ++i) layer.texture.draw(*drawables[i]);
+    layer.texture.display();
+    layer.sprite.setTexture(layer.texture.getTexture(), true);
+    layer.sprite.setPosition(left, top);
+    layer.ready = true;
+}
+
+void RetainedHud::drawLayer(InstrumentedTarget& target, const CachedLayer& layer, const sf::Drawable* const* drawables, size_t count) {
+    if (layer.ready) {
+        target.draw(layer.sprite, sf::RenderStates(kPremultipliedAlpha));
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) target.draw(*drawables[i]);
+}
+
+void RetainedHud::updateIcons() {
+    const HudResources& r = shownResources;
+    const bool rifle = shown.rifleEquipped;
+    const sf::Texture* topTex = rifle ? r.rifleIcon : r.pistolIcon;
+    const sf::Texture* bottomTex = rifle ? r.pistolIcon : r.rifleIcon;
+    hasTopIcon = topTex != nullptr;
+    hasBottomIcon = bottomTex != nullptr;
+    if (topTex) placeIcon(topIcon, *topTex, panelTop, rifle ? r.rifleTopScale : r.pistolTopScale, iconLineX);
+    if (bottomTex) placeIcon(bottomIcon, *bottomTex, panelBottom, rifle ? r.pistolBottomScale : r.rifleBottomScale, iconLineX);
+
+    // Key that equips the holstered weapon, at its original pixel size left of the bottom panel
+    const sf::Texture* ktex = rifle ? r.keyIcon2 : r.keyIcon1;
+    hasKeyIcon = ktex && ktex->getSize().x > 0 && ktex->getSize().y > 0;
+    if (hasKeyIcon) {
+        const sf::Vector2u ts = ktex->getSize();
+        keyIcon.setTexture(*ktex, true);
+        keyIcon.setPosition(panelBottom.left - 8.f - static_cast<float>(ts.x), panelBottom.top + (panelBottom.height - static_cast<float>(ts.y)) * 0.5f);
+    }
+    iconsValid = true;
+}
+
+void RetainedHud::updateAmmo(const HudValues& values) {
+    if (ammoValid && values.topAmmo == shown.topAmmo && values.topMag == shown.topMag
+        && values.bottomAmmo == shown.bottomAmmo && values.bottomMag == shown.bottomMag) return;
+    shown.topAmmo = values.topAmmo;
+    shown.topMag = values.topMag;
+    shown.bottomAmmo = values.bottomAmmo;
+    shown.bottomMag = values.bottomMag;
+    if (shownResources.font) {
+        placeAmmo(topAmmoText, topMagText, *shownResources.font, values.topAmmo, values.topMag, panelTop);
+        placeAmmo(bottomAmmoText, bottomMagText, *shownResources.font, values.bottomAmmo, values.bottomMag, panelBottom);
+    }
+    ammoValid = true;
+}
+
+void RetainedHud::updateBars(const HudValues& values) {
+    if (barsValid && values.health == shown.health && values.stamina == shown.stamina && values.damageFlashEdge == shown.damageFlashEdge) return;
+    shown.health = values.health;
+    shown.stamina = values.stamina;
+    shown.damageFlashEdge = values.damageFlashEdge;
+    healthFill.setSize(sf::Vector2f(kBarWidth * values.health, kBarHeight));
+    staminaFill.setSize(sf::Vector2f(kBarWidth * values.stamina, kBarHeight));
+    // The missing part of the health bar shows red while a damage flash is active
+    const float flashW = kBarWidth * (values.damageFlashEdge - values.health);
+    flashFill.setSize(sf::Vector2f(std::max(0.0f, flashW), kBarHeight));
+    flashFill.setPosition(barPos.x + kBarWidth * values.health, barPos.y);
+    barsValid = true;
+}
+
+void RetainedHud::draw(InstrumentedTarget& target, const sf::Vector2u& windowSize, const HudResources& resources, const HudValues& values) {
+    if (!layoutValid || windowSize != layoutSize) rebuildLayout(windowSize);
+    if (resources != shownResources) {
+        shownResources = resources;
+        iconsValid = false;
+        ammoValid = false;
+    }
+    if (!iconsValid || values.rifleEquipped != shown.rifleEquipped) {
+        shown.rifleEquipped = values.rifleEquipped;
+        updateIcons();
+    }
+    updateAmmo(values);
+    updateBars(values);
+
+    const sf::Drawable* bars[] = { &barContainer, &healthBg, &staminaBg };
+    drawLayer(target, barsLayer, bars, 3);
+    target.draw(healthFill);
+    if (flashFill.getSize().x > 0.0f) target.draw(flashFill);
+    target.draw(staminaFill);
+
+    const sf::Drawable* panelShapes[] = { &panelTopShape, &panelBottomShape };
+    drawLayer(target, panelsLayer, panelShapes, 2);
+    // Icons sit inside the panels, under the white frame
+    if (hasTopIcon) target.draw(topIcon);
+    if (hasBottomIcon) target.draw(bottomIcon);
+    if (hasKeyIcon) target.draw(keyIcon);
+    if (shownResources.font) {
+        target.draw(topAmmoText);
+        target.draw(topMagText);
+        target.draw(bottomAmmoText);
+        target.draw(bottomMagText);
+    }
+    target.draw(panelFrame);
+}
@@ -0,0 +1,277 @@
+#include "SdfFont.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    const sf::Uint32 kFirstChar = 32;
+    const sf::Uint32 kLastChar = 126;
+    const unsigned kAtlasWidth = 1024;
+
+    // Alpha holds the distance field (0.5 on the glyph edge); fill and outline are thresholds on it,
+    // smoothed over about one screen pixel
+    const char* kSdfShader = R"(
+        uniform sampler2D texture;
+        uniform float u_smoothing;
+        uniform float u_outline;
+        uniform vec4 u_outlineColor;
+        void main()
+        {
+            float d = texture2D(texture, gl_TexCoord[0].xy).a;
+            float fill = smoothstep(0.5 - u_smoothing, 0.5 + u_smoothing, d);
+            float shape = smoothstep(0.5 - u_outline - u_smoothing, 0.5 - u_outline + u_smoothing, d);
+            vec4 col = mix(u_outlineColor, gl_Color, fill);
+            gl_FragColor = vec4(col.rgb, col.a * shape);
+        }
+    )";
+
+    // Signed distance (in texels, positive inside) from each texel of a glyph bitmap padded by spread,
+    // mapped to 0..255 with the edge at 128. Brute force within the spread radius: it runs once per
+    // glyph at startup.
+    void writeField(sf::Image& out, unsigned ox, unsigned oy, const std::vector<uint8_t>& inside,
+                    int srcW, int srcH, int spread) {
+        const int w = srcW + spread * 2, h = srcH + spread * 2;
+        auto isInside = [&](int x, int y) {
+            x -= spread; y -= spread;
+            return x >= 0 && y >= 0 && x < srcW && y < srcH && inside[static_cast<size_t>(y) * srcW + x] != 0;
+        };
+        const float maxDist = static_cast<float>(spread);
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                const bool in = isInside(x, y);
+                float best = maxDist * maxDist;
+                for (int dy = -spread; dy <= spread; ++dy) {
+                    for (int dx = -spread; dx <= spread; ++dx) {
+                        const float d2 = static_cast<float>(dx * dx + dy * dy);
+                        if (d2 >= best) continue;
+                        if (isInside(x + dx, y + dy) != in) best = d2;
+                    }
+                }
+                float dist = std::min(maxDist, std::sqrt(best) - 0.5f);
+                float value = 0.5f + (in ? dist : -dist) / (2.0f * maxDist);
+                sf::Uint8 a = static_cast<sf::Uint8>(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+                out.setPixel(ox + x, oy + y, sf::Color(255, 255, 255, a));
+            }
+        }
+    }
+}
+
+bool SdfFont::loadFromFont(const sf::Font& font, bool boldStyle, unsigned size, unsigned fieldSpread) {
+    source = &font;
+    bold = boldStyle;
+    baseSize = size;
+    spread = std::max(1u, fieldSpread);
+    ready = false;
+    glyphs.clear();
+
+    if (!sf::Shader::isAvailable()) return false;
+    if (!shader.loadFromMemory(kSdfShader, sf::Shader::Fragment)) {
+        std::cerr << "Error compiling SDF text shader" << std::endl;
+        return false;
+    }
+
+    // Rasterize every glyph once at the base size, then read the page back
+    for (sf::Uint32 c = kFirstChar; c <= kLastChar; ++c) font.getGlyph(c, baseSize, bold);
+    const sf::Image page = font.getTexture(baseSize).copyToImage();
+
+    // Shelf-pack the padded glyph cells
+    struct Cell { sf::Uint32 code; sf::IntRect src; unsigned x, y; };
+    std::vector<Cell> cells;
+    unsigned x = 0, y = 0, rowH = 0;
+    for (sf::Uint32 c = kFirstChar; c <= kLastChar; ++c) {
+        const sf::Glyph& g = font.getGlyph(c, baseSize, bold);
+        Glyph& out = glyphs[c];
+        out.advance = g.advance;
+        out.bounds = g.bounds;
+        if (g.textureRect.width <= 0 || g.textureRect.height <= 0) continue;
+        const unsigned w = g.textureRect.width + spread * 2, h = g.textureRect.height + spread * 2;
+        if (x + w > kAtlasWidth) { x = 0; y += rowH; rowH = 0; }
+        cells.push_back({ c, g.textureRect, x, y });
+        x += w;
+        rowH = std::max(rowH, h);
+    }
+    const unsigned atlasHeight = std::max(1u, y + rowH);
+    if (atlasHeight > sf::Texture::getMaximumSize()) {
+        std::cerr << "SDF atlas too large (" << atlasHeight << " px)" << std::endl;
+        return false;
+    }
+
+    sf::Image image;
+    image.create(kAtlasWidth, atlasHeight, sf::Color(255, 255, 255, 0));
+    std::vector<uint8_t> inside;
+    const float s = static_cast<float>(spread);
+    for (const Cell& cell : cells) {
+        inside.assign(static_cast<size_t>(cell.src.width) * cell.src.height, 0);
+        for (int py = 0; py < cell.src.height; ++py)
+            for (int px = 0; px < cell.src.width; ++px)
+                inside[static_cast<size_t>(py) * cell.src.width + px] = page.getPixel(cell.src.left + px, cell.src.top + py).a >= 128;
+        writeField(image, cell.x, cell.y, inside, cell.src.width, cell.src.height, static_cast<int>(spread));
+
+        Glyph& g = glyphs[cell.code];
+        g.quad = sf::FloatRect(g.bounds.left - s, g.bounds.top - s, g.bounds.width + s * 2.f, g.bounds.height + s * 2.f);
+        g.texRect = sf::FloatRect(static_cast<float>(cell.x), static_cast<float>(cell.y),
+                                  static_cast<float>(cell.src.width) + s * 2.f, static_cast<float>(cell.src.height) + s * 2.f);
+    }
+
+    if (!atlas.loadFromImage(image)) {
+        std::cerr << "Error creating SDF atlas texture" << std::endl;
+        return false;
+    }
+    atlas.setSmooth(true);
+    ready = true;
+    return true;
+}
+
+const SdfFont::Glyph* SdfFont::getGlyph(sf::Uint32 codePoint) const {
+    auto it = glyphs.find(codePoint);
+    return it != glyphs.end() ? &it->second : nullptr;
+}
+
+float SdfFont::getKerning(sf::Uint32 first, sf::Uint32 second) const {
+    return source ? source->getKerning(first, second, baseSize, bold) : 0.0f;
+}
+
+float SdfFont::getLineSpacing() const {
+    return source ? source->getLineSpacing(baseSize) : static_cast<float>(baseSize);
+}
+
+void SdfText::setFont(const SdfFont& f) {
+    if (font != &f) { font = &f; geometryDirty = true; }
+}
+
+void SdfText::setString(const sf::String& s) {
+    if (string != s) { string = s; geometryDirty = true; }
+}
+
+void SdfText::setCharacterSize(unsigned size) {
+    if (characterSize != size) { characterSize = size; geometryDirty = true; }
+}
+
+void SdfText::setFillColor(const sf::Color& color) {
+    if (fillColor != color) { fillColor = color; geometryDirty = true; }
+}
+
+void SdfText::setOutlineThickness(float thickness) {
+    if (outlineThickness != thickness) { outlineThickness = thickness; geometryDirty = true; }
+}
+
+void SdfText::ensureGeometry() const {
+    if (!geometryDirty) return;
+    geometryDirty = false;
+    vertices.clear();
+    bounds = sf::FloatRect();
+    if (!font || !font->isReady()) return;
+
+    // Same layout as sf::Text: the first baseline sits at characterSize, metrics scaled from the base size
+    const float scale = static_cast<float>(characterSize) / static_cast<float>(font->getBaseSize());
+    float x = 0.f;
+    float y = static_cast<float>(characterSize);
+    float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+    bool any = false;
+    sf::Uint32 prev = 0;
+    for (std::size_t i = 0; i < string.getSize(); ++i) {
+        const sf::Uint32 c = string[i];
+        if (c == '\r') continue;
+        x += font->getKerning(prev, c) * scale;
+        prev = c;
+        if (c == '\n') {
+            x = 0.f;
+            y += font->getLineSpacing() * scale;
+            continue;
+        }
+        const SdfFont::Glyph* g = font->getGlyph(c);
+        if (!g) continue;
+        if (g->texRect.width > 0.f) {
+            const float l = x + g->quad.left * scale, t = y + g->quad.top * scale;
+            const float r = l + g->quad.width * scale, b = t + g->quad.height * scale;
+            const float u0 = g->texRect.left, v0 = g->texRect.top;
+            const float u1 = u0 + g->texRect.width, v1 = v0 + g->texRect.height;
+            vertices.append(sf::Vertex(sf::Vector2f(l, t), fillColor, sf::Vector2f(u0, v0)));
+            vertices.append(sf::Vertex(sf::Vector2f(r, t), fillColor, sf::Vector2f(u1, v0)));
+            vertices.append(sf::Vertex(sf::Vector2f(l, b), fillColor, sf::Vector2f(u0, v1)));
+            vertices.append(sf::Vertex(sf::Vector2f(l, b), fillColor, sf::Vector2f(u0, v1)));
+            vertices.append(sf::Vertex(sf::Vector2f(r, t), fillColor, sf::Vector2f(u1, v0)));
+            vertices.append(sf::Vertex(sf::Vector2f(r, b), fillColor, sf::Vector2f(u1, v1)));
+
+            const float gl = x + g->bounds.left * scale, gt = y + g->bounds.top * scale;
+            const float gr = gl + g->bounds.width * scale, gb = gt + g->bounds.height * scale;
+            if (!any) { minX = gl; minY = gt; maxX = gr; maxY = gb; any = true; }
+            minX = std::min(minX, gl); minY = std::min(minY, gt);
+            maxX = std::max(maxX, gr); maxY = std::max(maxY, gb);
+        }
+        x += g->advance * scale;
+    }
+    // Like sf::Text, the bounds include the outline
+    const float o = std::abs(outlineThickness);
+    if (any) bounds = sf::FloatRect(minX - o, minY - o, maxX - minX + o * 2.f, maxY - minY + o * 2.f);
+}
+
+const sf::Text& SdfText::fallbackText() const {
+    if (font && font->getSourceFont()) fallback.setFont(*font->getSourceFont());
+    fallback.setString(string);
+    fallback.setCharacterSize(characterSize);
+    fallback.setStyle(font && font->isBold() ? sf::Text::Bold : sf::Text::Regular);
+    fallback.setFillColor(fillColor);
+    fallback.setOutlineColor(outlineColor);
+    fallback.setOutlineThickness(outlineThickness);
+    return fallback;
+}
+
+std::size_t SdfText::getVertexCount() const {
+    if (!font) return 0;
+    if (!font->isReady()) {
+        if (!font->getSourceFont()) return 0;
+        // two triangles per character, and a second pass for the outline
+        return string.getSize() * 6 * (outlineThickness != 0.f ? 2 : 1);
+    }
+    ensureGeometry();
+    return vertices.getVertexCount();
+}
+
+const sf::Texture* SdfText::getTexture() const {
+    if (!font) return nullptr;
+    if (font->isReady()) return &font->getTexture();
+    return font->getSourceFont() ? &font->getSourceFont()->getTexture(characterSize) : nullptr;
+}
+
+sf::FloatRect SdfText::getLocalBounds() const {
+    if (!font) return sf::FloatRect();
+    if (!font->isReady()) return fallbackText().getLocalBounds();
+    ensureGeometry();
+    return bounds;
+}
+
+void SdfText::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (!font) return;
+    states.transform *= getTransform();
+    if (!font->isReady()) {
+        if (font->getSourceFont()) target.draw(fallbackText(), states);
+        return;
+    }
+    ensureGeometry();
+    if (vertices.getVertexCount() == 0) return;
+
+    // Field units per screen pixel: the field drops 0.5 over `spread` atlas texels
+    const sf::Vector2f s = getScale();
+    const float scale = static_cast<float>(characterSize) / static_cast<float>(font->getBaseSize())
+                        * std::max(std::abs(s.x), std::abs(s.y));
+    const float perPixel = 1.0f / (2.0f * static_cast<float>(font->getSpread()) * std::max(scale, 0.0001f));
+    sf::Shader& shader = font->getShader();
+    shader.setUniform("texture", sf::Shader::CurrentTexture);
+    shader.setUniform("u_smoothing", std::clamp(perPixel * 0.7f, 0.001f, 0.25f));
+    shader.setUniform("u_outline", std::clamp(std::abs(outlineThickness) * perPixel, 0.0f, 0.45f));
+    shader.setUniform("u_outlineColor", sf::Glsl::Vec4(outlineThickness != 0.f ? outlineColor : fillColor));
+    states.texture = &font->getTexture();
+    states.shader = &shader;
+    target.draw(vertices, states);
+}
+
+void prewarmGlyphs(const sf::Font& font, const std::vector<GlyphStyle>& styles, const sf::String& characters) {
+    for (const GlyphStyle& style : styles) {
+        if (characters.isEmpty()) {
+            for (sf::Uint32 c = kFirstChar; c <= kLastChar; ++c) font.getGlyph(c, style.size, style.bold, style.outline);
+        } else {
+            for (std::size_t i = 0; i < characters.getSize(); ++i) font.getGlyph(characters[i], style.size, style.bold, style.outline);
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#include "ShadowBarRenderer.h"
+#include "RenderQueue.h"
+#include <algorithm>
+
+void ShadowBarRenderer::appendQuad(std::vector<sf::Vertex>& out, const sf::FloatRect& rect, const sf::Color& color) {
+    const float r = rect.left + rect.width, b = rect.top + rect.height;
+    out.emplace_back(sf::Vector2f(rect.left, rect.top), color);
+    out.emplace_back(sf::Vector2f(r, rect.top), color);
+    out.emplace_back(sf::Vector2f(r, b), color);
+    out.emplace_back(sf::Vector2f(rect.left, b), color);
+}
+
+void ShadowBarRenderer::addShadow(const sf::Vector2f& center, float scale, const sf::Color& color) {
+    if (!shadowTexture) return;
+    const sf::Vector2f ts(static_cast<float>(shadowTexture->getSize().x), static_cast<float>(shadowTexture->getSize().y));
+    const sf::Vector2f half(ts.x * 0.5f * scale, ts.y * 0.5f * scale);
+    appendQuad(shadowVertices, sf::FloatRect(center.x - half.x, center.y - half.y, half.x * 2.0f, half.y * 2.0f), color);
+    sf::Vertex* q = &shadowVertices[shadowVertices.size() - 4];
+    q[0].texCoords = sf::Vector2f(0.f, 0.f);
+    q[1].texCoords = sf::Vector2f(ts.x, 0.f);
+    q[2].texCoords = ts;
+    q[3].texCoords = sf::Vector2f(0.f, ts.y);
+}
+
+void ShadowBarRenderer::addBar(const sf::Vector2f& center, const sf::Vector2f& size, float fill, const sf::Color& background, const sf::Color& foreground) {
+    fill = std::clamp(fill, 0.0f, 1.0f);
+    appendQuad(barVertices, sf::FloatRect(center.x - size.x * 0.5f, center.y - size.y * 0.5f, size.x, size.y), background);
+    // foreground stays centred within the background as it shrinks
+    const float w = size.x * fill;
+    if (w > 0.0f) appendQuad(barVertices, sf::FloatRect(center.x - w * 0.5f, center.y - size.y * 0.5f, w, size.y), foreground);
+}
+
+void ShadowBarRenderer::submit(RenderQueue& queue) {
+    queue.submitQuads(RenderLayer::Shadows, shadowTexture, sf::BlendAlpha, shadowVertices.data(), shadowVertices.size());
+    queue.submitQuads(RenderLayer::HealthBars, nullptr, sf::BlendAlpha, barVertices.data(), barVertices.size());
+    shadowVertices.clear();
+    barVertices.clear();
+}
@@ -0,0 +1,75 @@
+#include "TextureAtlas.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+const TextureAtlas& TextureAtlas::shared() {
+    static TextureAtlas atlas;
+    static bool attempted = false;
+    if (!attempted) {
+        attempted = true;
+        // Optional: without a packed atlas every loader uses its loose sheets
+        std::ifstream probe("assets/atlas/atlas.txt");
+        if (probe) atlas.loadFromFile("assets/atlas/atlas.txt");
+    }
+    return atlas;
+}
+
+bool TextureAtlas::loadFromFile(const std::string& metadataPath) {
+    pages.clear();
+    frames.clear();
+
+    std::ifstream in(metadataPath);
+    if (!in) {
+        std::cerr << "Error opening texture atlas: " << metadataPath << std::endl;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream ls(line);
+        std::string kind;
+        ls >> kind;
+        if (kind == "page") {
+            size_t index = 0;
+            std::string file;
+            ls >> index >> file;
+            if (pages.size() <= index) pages.resize(index + 1);
+            pages[index] = std::make_unique<sf::Texture>();
+            if (!pages[index]->loadFromFile(file)) {
+                std::cerr << "Error loading texture atlas page: " << file << std::endl;
+                pages.clear();
+                frames.clear();
+                return false;
+            }
+        } else if (kind == "frame") {
+            std::string name;
+            size_t page = 0;
+            Frame f;
+            ls >> name >> page >> f.rect.left >> f.rect.top >> f.rect.width >> f.rect.height;
+            // pages are written before frames, so the texture is already known
+            if (page < pages.size() && pages[page]) {
+                f.texture = pages[page].get();
+                frames[name] = f;
+            }
+        }
+    }
+    return isLoaded();
+}
+
+const TextureAtlas::Frame* TextureAtlas::find(const std::string& name) const {
+    auto it = frames.find(name);
+    return it != frames.end() ? &it->second : nullptr;
+}
+
+bool TextureAtlas::getSequence(const std::string& name, const sf::Texture*& outTexture, std::vector<sf::IntRect>& outRects) const {
+    outRects.clear();
+    for (int i = 0;; ++i) {
+        const Frame* f = find(name + "_" + std::to_string(i));
+        if (!f) break;
+        if (i == 0) outTexture = f->texture;
+        outRects.push_back(f->rect);
+    }
+    return !outRects.empty();
+}
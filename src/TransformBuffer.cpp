@@ -0,0 +1,50 @@
+#include "TransformBuffer.h"
+#include <algorithm>
+
+TransformBuffer& TransformBuffer::instance() {
+    static TransformBuffer buffer;
+    return buffer;
+}
+
+uint32_t TransformBuffer::acquire(const sf::Vector2f& position) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(curr.size() / 2);
+        prev.resize(prev.size() + 2);
+        curr.resize(curr.size() + 2);
+        interpolated.resize(interpolated.size() + 2);
+    }
+    teleport(slot, position);
+    return slot;
+}
+
+void TransformBuffer::release(uint32_t slot) {
+    freeSlots.push_back(slot);
+}
+
+void TransformBuffer::beginStep() {
+    std::copy(curr.begin(), curr.end(), prev.begin());
+}
+
+void TransformBuffer::setCurrent(uint32_t slot, const sf::Vector2f& position) {
+    curr[2 * slot] = position.x;
+    curr[2 * slot + 1] = position.y;
+}
+
+void TransformBuffer::teleport(uint32_t slot, const sf::Vector2f& position) {
+    prev[2 * slot] = curr[2 * slot] = interpolated[2 * slot] = position.x;
+    prev[2 * slot + 1] = curr[2 * slot + 1] = interpolated[2 * slot + 1] = position.y;
+}
+
+void TransformBuffer::interpolate(float a) {
+    alpha = a;
+    // One flat loop over x and y alike (free slots included), which the compiler vectorizes
+    const size_t n = curr.size();
+    const float* p = prev.data();
+    const float* c = curr.data();
+    float* out = interpolated.data();
+    for (size_t i = 0; i < n; ++i) out[i] = p[i] + (c[i] - p[i]) * a;
+}
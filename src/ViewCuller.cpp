@@ -0,0 +1,35 @@
+#include "ViewCuller.h"
+#include "DebugDraw.h"
+
+void ViewCuller::begin(const sf::View& view, float padding) {
+    const sf::Vector2f c = view.getCenter();
+    const sf::Vector2f s = view.getSize();
+    rect = sf::FloatRect(c.x - s.x * 0.5f - padding, c.y - s.y * 0.5f - padding, s.x + padding * 2.0f, s.y + padding * 2.0f);
+    drawn.fill(0);
+    culled.fill(0);
+}
+
+bool ViewCuller::accept(Category category, const sf::FloatRect& bounds) {
+    const bool visible = rect.intersects(bounds);
+    (visible ? drawn : culled)[static_cast<size_t>(category)]++;
+    if (DebugDraw::isEnabled() && visible) DebugDraw::rect(bounds, sf::Color(0, 255, 0, 70));
+    return visible;
+}
+
+bool ViewCuller::accept(Category category, const sf::Vector2f& center, float radius) {
+    return accept(category, sf::FloatRect(center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f));
+}
+
+void ViewCuller::reportDebugShapes() const {
+    DebugDraw::rect(rect, sf::Color(255, 255, 0, 160));
+}
+
+const char* ViewCuller::getName(Category category) {
+    switch (category) {
+    case Category::Zombies: return "zombies";
+    case Category::Bullets: return "bullets";
+    case Category::Explosions: return "blood";
+    case Category::Guts: return "guts";
+    default: return "?";
+    }
+}
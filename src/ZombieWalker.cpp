@@ -1,19 +1,71 @@
 #include "ZombieWalker.h"
+#include "ZombieBehavior.h"
+#include "TextureAtlas.h"
 #include <iostream>
 
+// Sheets and frame rects are loaded once and shared by every walker. Pooled zombies used to load
+// their own copies, which cost ~10 MB of texture memory per instance and made large hordes impossible.
+static sf::Texture s_walkSheet;
+static sf::Texture s_attackSheet;
+// Either the loose sheets above or the packed atlas page holding the frames
+static const sf::Texture* s_walkTexture = &s_walkSheet;
+static const sf::Texture* s_attackTexture = &s_attackSheet;
+static std::vector<sf::IntRect> s_walkRects;
+static std::vector<sf::IntRect> s_attackRects;
+static bool s_walkSheetLoaded = false;
+static bool s_attackSheetLoaded = false;
+static bool s_sheetsAttempted = false;
+
+static void loadSharedSheets() {
+    if (s_sheetsAttempted) return;
+    s_sheetsAttempted = true;
+
+    const TextureAtlas& atlas = TextureAtlas::shared();
+    if (atlas.getSequence("zombie_walker_move", s_walkTexture, s_walkRects)) {
+        s_walkSheetLoaded = true;
+    } else if (s_walkSheet.loadFromFile("assets/ZombieWalker/zombie_move.png")) {
+        s_walkSheetLoaded = true;
+        int frameW = 228; int frameH = 311; // set your frame size
+        sf::Vector2u ts = s_walkSheet.getSize();
+        int cols = ts.x / frameW;
+        int rows = ts.y / frameH;
+        for (int r = 0; r < rows; ++r)
+          for (int c = 0; c < cols; ++c)
+            s_walkRects.emplace_back(c*frameW, r*frameH, frameW, frameH);
+    } else {
+        std::cerr << "Error loading zombie walk sheet: assets/ZombieWalker/zombie_move.png" << std::endl;
+    }
+
+    if (atlas.getSequence("zombie_walker_attack", s_attackTexture, s_attackRects)) {
+        s_attackSheetLoaded = true;
+    } else if (s_attackSheet.loadFromFile("assets/ZombieWalker/zombie_attack.png")) {
+        s_attackSheetLoaded = true;
+        int frameW = 318; int frameH = 294; // set your frame size
+        sf::Vector2u ts = s_attackSheet.getSize();
+        int cols = ts.x / frameW;
+        int rows = ts.y / frameH;
+        for (int r = 0; r < rows; ++r)
+          for (int c = 0; c < cols; ++c)
+            s_attackRects.emplace_back(c*frameW, r*frameH, frameW, frameH);
+    } else {
+        std::cerr << "Error loading zombie attack sheet: assets/ZombieWalker/zombie_attack.png" << std::endl;
+    }
+}
+
 ZombieWalker::ZombieWalker(float x, float y)
     : ZombieWalker(x, y, 50.0f, 5.0f, 50.0f) {}
 
 ZombieWalker::ZombieWalker(float x, float y, float health, float attackDamage, float speed)
-    : BaseZombie(x, y, health, attackDamage, speed, 100.0f, 2.0f) // attackRange, attackCooldown
+    : BaseZombie(x, y, health, attackDamage, speed, ZombieTraits<kType>::attackRange, ZombieTraits<kType>::attackCooldown)
 {
+    attackFrameTime = ZombieTraits<kType>::attackFrameTime;
     // Tweak walker rotation to match sprite art orientation
     rotationOffset = 0.0f; // adjust if sprite faces a different base direction
     loadTextures();
 
     // If a spritesheet was provided (walkSheetTexture + walkRects), use that with Animator; otherwise fall back to per-frame textures
     if (hasWalkSheet && walkRects.size() > 0) {
-        sprite.setTexture(walkSheetTexture);
+        sprite.setTexture(*walkSheetTexture);
         // show the first frame immediately instead of the full sheet
         sprite.setTextureRect(walkRects[0]);
         // center origin based on first rect
@@ -29,7 +81,7 @@ ZombieWalker::ZombieWalker(float x, float y, float health, float attackDamage, f
     setState(ZombieState::WALK);
     // Ensure animator is configured and playing immediately (some edge cases need explicit start)
     if (hasWalkSheet && !walkRects.empty()) {
-        animator.setFrames(&walkSheetTexture, walkRects, walkFrameTime, true);
+        animator.setFrames(walkSheetTexture, walkRects, walkFrameTime, true);
         animator.play(true);
     } else if (!walkTextures.empty()) {
         animator.setFrames(&walkTextures, walkFrameTime, true);
@@ -39,104 +91,19 @@ ZombieWalker::ZombieWalker(float x, float y, float health, float attackDamage, f
 }
 
 void ZombieWalker::loadTextures() {
-    // load a single sheet instead of per-frame files
-    if (walkSheetTexture.loadFromFile("assets/ZombieWalker/zombie_move.png")) {
+    // single sheets shared by all walkers (loaded on first construction)
+    loadSharedSheets();
+    if (s_walkSheetLoaded) {
         hasWalkSheet = true;
-        int frameW = 228; int frameH = 311; // set your frame size
-        sf::Vector2u ts = walkSheetTexture.getSize();
-        int cols = ts.x / frameW;
-        int rows = ts.y / frameH;
-        walkRects.clear();
-        for (int r = 0; r < rows; ++r)
-          for (int c = 0; c < cols; ++c)
-            walkRects.emplace_back(c*frameW, r*frameH, frameW, frameH);
+        walkSheetTexture = s_walkTexture;
+        walkRects = s_walkRects;
     }
 
-    if (attackSheetTexture.loadFromFile("assets/ZombieWalker/zombie_attack.png")) {
+    if (s_attackSheetLoaded) {
         hasAttackSheet = true;
-        int frameW = 318; int frameH = 294; // set your frame size
-        sf::Vector2u ts = attackSheetTexture.getSize();
-        int cols = ts.x / frameW;
-        int rows = ts.y / frameH;
-        attackRects.clear();
-        for (int r = 0; r < rows; ++r)
-          for (int c = 0; c < cols; ++c)
-            attackRects.emplace_back(c*frameW, r*frameH, frameW, frameH);
-    }
-
-    // No death textures needed  zombies despawn immediately on death
-}
-
-void ZombieWalker::updateAnimation(float deltaTime) {
-    // run base animation handling first (this will also advance animator)
-    BaseZombie::updateAnimation(deltaTime);
-
-    // If currently attacking, check animator frame to trigger lunge or allow damage
-    if (currentState == ZombieState::ATTACK) {
-        size_t frame = animator.getCurrentFrameIndex();
-
-        // On pre-lunge frame, stop movement next frame (but keep rotating until lunge starts)
-        if (!this->preLungeHandled && (int)frame >= this->preLungeFrame) {
-            this->preLungeHandled = true;
-            body.velocity = Vec2(0,0);
-        }
-
-        // Speed up first 4 frames by lowering frame time; restore after
-        if ((int)frame < 4) animator.setFrameTime(attackFrameTime * 0.5f);
-        else animator.setFrameTime(attackFrameTime);
-
-        // Start lunge on configured start frame
-        if (!this->lunging && (int)frame >= this->lungeStartFrame) {
-            // snapshot player's position so lunge continues even if player moves
-            this->lungeTargetPos = this->lastSeenPlayerPos;
-            sf::Vector2f pos = sf::Vector2f(body.position.x, body.position.y);
-            sf::Vector2f dir = sf::Vector2f(this->lungeTargetPos.x - pos.x, this->lungeTargetPos.y - pos.y);
-            float len = std::sqrt(dir.x*dir.x + dir.y*dir.y);
-            if (len > 0.0001f) this->lungeDir = Vec2(dir.x/len, dir.y/len);
-            else this->lungeDir = Vec2(std::cos((sprite.getRotation()-rotationOffset)*3.14159265f/180.f), std::sin((sprite.getRotation()-rotationOffset)*3.14159265f/180.f));
-
-            this->lunging = true;
-            this->lungeTimer = 0.0f;
-            // lock facing to lunge direction and disable rotation
-            float ang = std::atan2(this->lungeDir.y, this->lungeDir.x) * 180.0f / 3.14159265f;
-            sprite.setRotation(ang + rotationOffset);
-            this->canRotateOverride = false;
-            // (debug logging removed)
-        }
-
-        // reset damage flag when attack starts (frame 0)
-        if (animator.getCurrentFrameIndex() == 0) this->damageDealtThisAttack = false;
-        // update BaseZombie flag indicating whether this frame is part of damage window
-        bool inWindow = false;
-        int cf = static_cast<int>(animator.getCurrentFrameIndex());
-        for (int f : damageFrames) if (cf == f) { inWindow = true; break; }
-        this->isInDamageWindow = inWindow;
+        attackSheetTexture = s_attackTexture;
+        attackRects = s_attackRects;
     }
 
-    if (this->lunging) {
-        this->lungeTimer += deltaTime;
-        body.velocity = this->lungeDir * this->lungeSpeed;
-        int currentFrame = static_cast<int>(animator.getCurrentFrameIndex());
-        if (currentFrame >= this->lungeStopFrame || this->lungeTimer >= this->lungeDuration) {
-            this->lunging = false;
-            this->lungeTimer = 0.0f;
-            body.velocity = Vec2(0,0);
-            this->preLungeHandled = false;
-            this->canRotateOverride = true;
-        }
-    }
-}
-
-float ZombieWalker::tryDealDamage() {
-    // Only allow damage during specific attack frames
-    if (currentState == ZombieState::ATTACK) {
-        int frame = static_cast<int>(animator.getCurrentFrameIndex());
-        for (int f : damageFrames) {
-            if (frame == f && !damageDealtThisAttack) {
-                damageDealtThisAttack = true;
-                return attackDamage;
-            }
-        }
-    }
-    return 0.0f;
+    // No death textures needed: dead walkers become corpses (CorpseSystem) using ZombieTraits<kType>::corpse
 }
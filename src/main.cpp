@@ -1,12 +1,64 @@
 #include "Game.h"
 #include "Cutscene.h" // Corrected include path
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
 
-int main() {
-    Game game;
-    TDCod::Cutscene cutscene; // Create Cutscene object
+int main(int argc, char** argv) {
+    // --horde [maxZombies] skips the intro and starts the endless horde stress mode
+    // --render-thread draws the world on its own thread from simulation snapshots
+    // --benchmark [frames] runs the scripted render benchmark and exits (uses --horde's zombie cap);
+    //   --offscreen WxH sets the headless target size (default 1920x1080; the interactive game always
+    //   uses the fullscreen window),
+    //   --golden-every N and --golden-dir path save every Nth benchmark frame as a PNG, --seed N
+    bool horde = false;
+    int hordeMax = 0;
+    bool renderThread = false;
+    bool benchmark = false;
+    Game::BenchmarkOptions bench;
+    unsigned offscreenW = 0, offscreenH = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--horde") == 0) {
+            horde = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') hordeMax = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--render-thread") == 0) {
+            renderThread = true;
+        } else if (std::strcmp(argv[i], "--benchmark") == 0) {
+            benchmark = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') bench.frames = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--offscreen") == 0 && i + 1 < argc) {
+            if (std::sscanf(argv[++i], "%ux%u", &offscreenW, &offscreenH) != 2) offscreenW = offscreenH = 0;
+        } else if (std::strcmp(argv[i], "--golden-every") == 0 && i + 1 < argc) {
+            bench.goldenEvery = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--golden-dir") == 0 && i + 1 < argc) {
+            bench.goldenDir = argv[++i];
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            bench.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        }
+    }
+    if (!benchmark) {
+        offscreenW = offscreenH = 0;
+    } else if (offscreenW == 0 || offscreenH == 0) {
+        offscreenW = 1920;
+        offscreenH = 1080;
+    }
 
-    // Run the cutscene before the game
-    cutscene.run(game.getWindow());
+    Game game(sf::Vector2u(offscreenW, offscreenH));
+    game.setRenderThreadEnabled(renderThread);
+
+    if (benchmark) {
+        bench.hordeMax = hordeMax;
+        return game.runBenchmark(bench) ? 0 : 1;
+    }
+
+    if (horde) {
+        game.startHorde(hordeMax);
+    } else {
+        TDCod::Cutscene cutscene; // Create Cutscene object
+
+        // Run the cutscene before the game
+        cutscene.run(game.getWindow());
+    }
 
     game.run();
     return 0;
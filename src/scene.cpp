@@ -1,4 +1,6 @@
 #include "Cutscene.h"
+#include "RenderStats.h"
+#include "SdfFont.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
@@ -222,6 +224,14 @@ void Cutscene::run(sf::RenderWindow& window) {
     settingsButtonText.setCharacterSize(menuFontSize);
     exitButtonText.setCharacterSize(menuFontSize);
 
+    // Rasterize the menu, panel and dialogue glyph styles before the first frame shows them
+    prewarmGlyphs(font, {
+        { 96, true, 0.f }, { menuFontSize, false, 0.f }, { 52, false, 0.f }, { 36, false, 0.f },
+        { static_cast<unsigned int>(28u * SETTINGS_UI_SCALE), false, 0.f }, { 14, false, 0.f }
+    });
+    prewarmGlyphs(font2, { { 24, false, 0.f }, { static_cast<unsigned int>(18u * SETTINGS_UI_SCALE), false, 0.f } });
+    prewarmGlyphs(dialogueDisplayFont, { { 24, false, 0.f }, { 18, false, 0.f } });
+
     startButtonText.setString("Play");
     sf::FloatRect startButtonBounds = startButtonText.getLocalBounds();
     startButtonText.setOrigin(startButtonBounds.left + startButtonBounds.width/2.0f, startButtonBounds.top + startButtonBounds.height/2.0f);
@@ -301,6 +311,7 @@ void Cutscene::run(sf::RenderWindow& window) {
         handleEvents(window);
         update(deltaTime, window);
         render(window);
+        RenderStats::instance().endFrame();
 
         if (startFading && fadeAlpha >= 255.0f) {
             static sf::Clock endDelay;
@@ -649,6 +660,7 @@ void Cutscene::update(float deltaTime, sf::RenderWindow& window) {
 
 void TDCod::Cutscene::render(sf::RenderWindow& window) {
     window.clear();
+    InstrumentedTarget out(window, RenderPass::Cutscene);
 
     if (isMenuState) {
         window.setView(window.getDefaultView());
@@ -660,18 +672,18 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
             backgroundSprite.setScale(sx, sy);
         } else backgroundSprite.setScale(1.f,1.f);
 
-        window.draw(backgroundSprite);
+        out.draw(backgroundSprite);
         planetSprite.setScale(1.f,1.f);
         planetSprite.setPosition(static_cast<float>(window.getSize().x) - static_cast<float>(planetTexture.getSize().x) - 50.f,
                                   window.getSize().y/2.0f - static_cast<float>(planetTexture.getSize().y)/2.0f);
-        window.draw(planetSprite);
-        window.draw(titleBorder);
-        window.draw(titleText);
+        out.draw(planetSprite);
+        out.draw(titleBorder);
+        out.draw(titleText);
 
-        window.draw(startButtonText);
-        window.draw(controlsButtonText);
-        window.draw(settingsButtonText);
-        window.draw(exitButtonText);
+        out.draw(startButtonText);
+        out.draw(controlsButtonText);
+        out.draw(settingsButtonText);
+        out.draw(exitButtonText);
 
         if (showingControls || showingSettings) {
             sf::Vector2f panelSize(window.getSize().x * 0.6f, window.getSize().y * 0.6f);
@@ -687,7 +699,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
             const float PANEL_EXTRA_OFFSET = 80.f;
             float panelCenterY = titleBottom + gap + PANEL_EXTRA_OFFSET + panel.getSize().y / 2.f;
             panel.setPosition(window.getSize().x/2.f, panelCenterY);
-            window.draw(panel);
+            out.draw(panel);
 
             sf::Text title;
             title.setFont(font); title.setCharacterSize(52); title.setFillColor(sf::Color::White);
@@ -697,7 +709,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
             // center the title inside the panel
             title.setOrigin(tbb.left + tbb.width/2.f, tbb.top + tbb.height/2.f);
             title.setPosition(panel.getPosition().x, panel.getPosition().y - panel.getSize().y/2.f + 40.f);
-            window.draw(title);
+            out.draw(title);
 
             // Draw a short separator line below the title with fade to transparent at the edges
             float outline = panel.getOutlineThickness();
@@ -720,7 +732,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 sf::RectangleShape centerRect(sf::Vector2f(centerRight - centerLeft, sepThickness));
                 centerRect.setPosition(centerLeft, yTop);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                out.draw(centerRect);
             }
 
             // left fading quad (two triangles)
@@ -732,7 +744,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(xL, yTop), colTransparent);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerLeft, yBottom), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(xL, yBottom), colTransparent);
-                window.draw(leftGrad);
+                out.draw(leftGrad);
             }
 
             // right fading quad (two triangles)
@@ -744,7 +756,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerRight, yTop), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(xR, yBottom), colTransparent);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerRight, yBottom), colOpaque);
-                window.draw(rightGrad);
+                out.draw(rightGrad);
             }
 
             // Reserve icon slot and sizing vars (used by back button & content) - unscaled for general UI
@@ -806,8 +818,8 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 rightHeader.setPosition(rightColX + colWidth/4.f, headerY);
                 // startY for listing bars beneath headers
                 float startY = headerY + 24.f;
-                window.draw(leftHeader);
-                window.draw(rightHeader);
+                out.draw(leftHeader);
+                out.draw(rightHeader);
 
                 // Draw a short separator line across the top of each column (with fade to transparent at edges)
                 // Place this separator immediately above the first bars in the columns so it visually groups headers/bars.
@@ -832,7 +844,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                      sf::RectangleShape centerRectLeft(sf::Vector2f(leftCenterR - leftCenterL, colSepThickness));
                      centerRectLeft.setPosition(leftCenterL, colYTop);
                      centerRectLeft.setFillColor(colOpaqueTop);
-                     window.draw(centerRectLeft);
+                     out.draw(centerRectLeft);
                  }
                  if (leftCenterL > leftX0 + 1.f) {
                      sf::VertexArray leftGradCol(sf::Triangles, 6);
@@ -842,7 +854,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                      leftGradCol[3] = sf::Vertex(sf::Vector2f(leftX0, colYTop), colTransparentTop);
                      leftGradCol[4] = sf::Vertex(sf::Vector2f(leftCenterL, colYBottom), colOpaqueTop);
                      leftGradCol[5] = sf::Vertex(sf::Vector2f(leftX0, colYBottom), colTransparentTop);
-                     window.draw(leftGradCol);
+                     out.draw(leftGradCol);
                  }
 
                 // Draw a short vertical extension down the right side of the left column
@@ -855,7 +867,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     float vertX = leftXR - colSepThickness + VERT_SHIFT;
                     vert.setPosition(vertX, colYTop);
                     vert.setFillColor(colOpaqueTop);
-                    window.draw(vert);
+                    out.draw(vert);
 
                     // stronger vertical fade at the bottom of the vertical extension (fade downward)
                     const float FADE_H = 36.f; // stronger contrast at top
@@ -872,7 +884,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     fadeV[3] = sf::Vertex(sf::Vector2f(vertX, yTopFade), fadeOpaque);
                     fadeV[4] = sf::Vertex(sf::Vector2f(vertX + colSepThickness, yBottomFade), colTransparentTop);
                     fadeV[5] = sf::Vertex(sf::Vector2f(vertX, yBottomFade), colTransparentTop);
-                    window.draw(fadeV);
+                    out.draw(fadeV);
                 }
 
                 // Right column line
@@ -884,7 +896,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     sf::RectangleShape centerRectRight(sf::Vector2f(rightCenterR - rightCenterL, colSepThickness));
                     centerRectRight.setPosition(rightCenterL, colYTop);
                     centerRectRight.setFillColor(colOpaqueTop);
-                    window.draw(centerRectRight);
+                    out.draw(centerRectRight);
                 }
                 if (rightCenterL > rightX0 + 1.f) {
                     sf::VertexArray leftGradColR(sf::Triangles, 6);
@@ -894,7 +906,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     leftGradColR[3] = sf::Vertex(sf::Vector2f(rightX0, colYTop), colTransparentTop);
                     leftGradColR[4] = sf::Vertex(sf::Vector2f(rightCenterL, colYBottom), colOpaqueTop);
                     leftGradColR[5] = sf::Vertex(sf::Vector2f(rightX0, colYBottom), colTransparentTop);
-                    window.draw(leftGradColR);
+                    out.draw(leftGradColR);
                 }
 
                 // Draw a short vertical extension down the right side of the right column
@@ -905,7 +917,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     float vertRX = (rightColX + colWidth) - colSepThickness + VERT_SHIFT;
                     vertR.setPosition(vertRX, colYTop);
                     vertR.setFillColor(colOpaqueTop);
-                    window.draw(vertR);
+                    out.draw(vertR);
 
                     // stronger fade: increase height and top opacity for contrast
                     const float FADE_HR = 36.f;
@@ -921,7 +933,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     fadeVR[3] = sf::Vertex(sf::Vector2f(vertRX, yTopFadeR), fadeOpaqueR);
                     fadeVR[4] = sf::Vertex(sf::Vector2f(vertRX + colSepThickness, yBottomFadeR), colTransparentTop);
                     fadeVR[5] = sf::Vertex(sf::Vector2f(vertRX, yBottomFadeR), colTransparentTop);
-                    window.draw(fadeVR);
+                    out.draw(fadeVR);
                 }
 
                 // draw left column bars
@@ -932,7 +944,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     bar.setFillColor(sf::Color(36,36,36,220));
                     bar.setOutlineColor(sf::Color(100,100,100,200));
                     bar.setOutlineThickness(1.f);
-                    window.draw(bar);
+                    out.draw(bar);
 
                     // draw icon placeholder on left side of bar
                     sf::RectangleShape iconSlot(sf::Vector2f(iconSlotW, barHeight - 12.f));
@@ -951,9 +963,9 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                         float spriteX = leftColX + 8.f + (iconSlotW - spriteW) * 0.5f;
                         float spriteY = y + 6.f + (slotH - tsize.y * scale) * 0.5f;
                         iconSprites[iconIndex].setPosition(spriteX, spriteY);
-                        window.draw(iconSprites[iconIndex]);
+                        out.draw(iconSprites[iconIndex]);
                     } else {
-                        window.draw(iconSlot);
+                        out.draw(iconSlot);
                     }
 
                     // draw the label right-aligned within the bar (leaving icon slot on the left)
@@ -968,7 +980,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     float textX = leftColX + colWidth - textRightPadding - lb.width - lb.left;
                     float textY = y + (barHeight - lb.height) / 2.f - lb.top;
                     label.setPosition(textX, textY);
-                    window.draw(label);
+                    out.draw(label);
                 }
 
                 // draw right column bars
@@ -979,7 +991,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     bar.setFillColor(sf::Color(36,36,36,220));
                     bar.setOutlineColor(sf::Color(100,100,100,200));
                     bar.setOutlineThickness(1.f);
-                    window.draw(bar);
+                    out.draw(bar);
 
                     // icon slot on left of this bar too
                     sf::RectangleShape iconSlot(sf::Vector2f(iconSlotW, barHeight - 12.f));
@@ -998,9 +1010,9 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                         float spriteX = rightColX + 8.f + (slotW - spriteW) * 0.5f;
                         float spriteY = y + 6.f + (slotH - tsize.y * scale) * 0.5f;
                         iconSprites[iconIndexR].setPosition(spriteX, spriteY);
-                        window.draw(iconSprites[iconIndexR]);
+                        out.draw(iconSprites[iconIndexR]);
                     } else {
-                        window.draw(iconSlot);
+                        out.draw(iconSlot);
                     }
 
                     // draw the label right-aligned within the bar
@@ -1015,7 +1027,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     float textX = rightColX + colWidth - textRightPadding - rb.width - rb.left;
                     float textY = y + (barHeight - rb.height) / 2.f - rb.top;
                     label.setPosition(textX, textY);
-                    window.draw(label);
+                    out.draw(label);
                 }
              } // end if (!isSettings)
              else {
@@ -1032,7 +1044,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     lbl.setOrigin(lb.left + 0.f, lb.top + lb.height/2.f);
                     lbl.setCharacterSize(static_cast<unsigned int>(28u * SETTINGS_UI_SCALE));
                     lbl.setPosition(panel.getPosition().x - panel.getSize().x/2.f + panelPaddingInner, y + 8.f * SETTINGS_UI_SCALE);
-                    window.draw(lbl);
+                    out.draw(lbl);
 
                     // Slider background
                     float bgHeight = 12.f * SETTINGS_UI_SCALE;
@@ -1041,14 +1053,14 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     bg.setFillColor(sf::Color(60,60,60,220));
                     bg.setOutlineThickness(1.f);
                     bg.setOutlineColor(sf::Color(100,100,100,180));
-                    window.draw(bg);
+                    out.draw(bg);
 
                     // Filled portion
                     float frac = std::clamp(value / 100.f, 0.f, 1.f);
                     sf::RectangleShape fill(sf::Vector2f(sliderWidth * frac, bgHeight));
                     fill.setPosition(sliderX, y);
                     fill.setFillColor(sf::Color(200,200,200,220));
-                    window.draw(fill);
+                    out.draw(fill);
 
                     // Knob
                     float kx = sliderX + sliderWidth * frac;
@@ -1059,7 +1071,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     knob.setFillColor(sf::Color::White);
                     knob.setOutlineColor(sf::Color(120,120,120));
                     knob.setOutlineThickness(2.f);
-                    window.draw(knob);
+                    out.draw(knob);
 
                     // Percent text
                     sf::Text pct;
@@ -1069,7 +1081,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     pct.setString(std::to_string(static_cast<int>(value)) + "%");
                     sf::FloatRect pb = pct.getLocalBounds();
                     pct.setPosition(sliderX + sliderWidth + 8.f * SETTINGS_UI_SCALE, y - pb.top);
-                    window.draw(pct);
+                    out.draw(pct);
 
                     // Mute checkbox
                     float muteX = sliderX + sliderWidth + 60.f * SETTINGS_UI_SCALE; // slightly closer
@@ -1078,14 +1090,14 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     box.setFillColor(sf::Color(30,30,30,220));
                     box.setOutlineColor(sf::Color::White);
                     box.setOutlineThickness(1.f);
-                    window.draw(box);
+                    out.draw(box);
                     if (muted) {
                         sf::VertexArray cross(sf::Lines, 4);
                         cross[0] = sf::Vertex(sf::Vector2f(muteX + 4.f * SETTINGS_UI_SCALE, y - 1.f * SETTINGS_UI_SCALE), sf::Color::Red);
                         cross[1] = sf::Vertex(sf::Vector2f(muteX + 22.f * SETTINGS_UI_SCALE, y + 15.f * SETTINGS_UI_SCALE), sf::Color::Red);
                         cross[2] = sf::Vertex(sf::Vector2f(muteX + 22.f * SETTINGS_UI_SCALE, y - 1.f * SETTINGS_UI_SCALE), sf::Color::Red);
                         cross[3] = sf::Vertex(sf::Vector2f(muteX + 4.f * SETTINGS_UI_SCALE, y + 15.f * SETTINGS_UI_SCALE), sf::Color::Red);
-                        window.draw(cross);
+                        out.draw(cross);
                     }
                 };
 
@@ -1102,21 +1114,21 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                  dbgMaster.setFillColor(sf::Color(255, 0, 0, 60));
                  dbgMaster.setOutlineColor(sf::Color::White);
                  dbgMaster.setOutlineThickness(1.f);
-                 window.draw(dbgMaster);
+                 out.draw(dbgMaster);
 
                 sf::RectangleShape dbgMusic(sf::Vector2f(sliderWidth + 8.f, 20.f * SETTINGS_UI_SCALE));
                 dbgMusic.setPosition(sliderX - 4.f * SETTINGS_UI_SCALE, rowYStart + rowSpacing * SETTINGS_UI_SCALE - 6.f * SETTINGS_UI_SCALE);
                  dbgMusic.setFillColor(sf::Color(0, 255, 0, 60));
                  dbgMusic.setOutlineColor(sf::Color::White);
                  dbgMusic.setOutlineThickness(1.f);
-                 window.draw(dbgMusic);
+                 out.draw(dbgMusic);
 
                 sf::RectangleShape dbgSfx(sf::Vector2f(sliderWidth + 8.f, 20.f * SETTINGS_UI_SCALE));
                 dbgSfx.setPosition(sliderX - 4.f * SETTINGS_UI_SCALE, rowYStart + rowSpacing * 2 * SETTINGS_UI_SCALE - 6.f * SETTINGS_UI_SCALE);
                  dbgSfx.setFillColor(sf::Color(0, 0, 255, 60));
                  dbgSfx.setOutlineColor(sf::Color::White);
                  dbgSfx.setOutlineThickness(1.f);
-                 window.draw(dbgSfx);
+                 out.draw(dbgSfx);
 
                 // mute boxes
                 float muteX_dbg = sliderX + sliderWidth + 60.f * SETTINGS_UI_SCALE;
@@ -1125,11 +1137,11 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 dbgMute.setOutlineColor(sf::Color::White);
                 dbgMute.setOutlineThickness(1.f);
                 dbgMute.setPosition(muteX_dbg, rowYStart - 6.f * SETTINGS_UI_SCALE);
-                 window.draw(dbgMute);
+                 out.draw(dbgMute);
                  dbgMute.setPosition(muteX_dbg, rowYStart + rowSpacing * SETTINGS_UI_SCALE - 6.f * SETTINGS_UI_SCALE);
-                 window.draw(dbgMute);
+                 out.draw(dbgMute);
                  dbgMute.setPosition(muteX_dbg, rowYStart + rowSpacing * 2 * SETTINGS_UI_SCALE - 6.f * SETTINGS_UI_SCALE);
-                 window.draw(dbgMute);
+                 out.draw(dbgMute);
 
                 // Draw mapped mouse position crosshair (default view) to help diagnose offsets
                 sf::Vector2i mp = sf::Mouse::getPosition(window);
@@ -1138,13 +1150,13 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 ch.setOrigin(4.f, 4.f);
                 ch.setPosition(mw);
                 ch.setFillColor(sf::Color::Magenta);
-                window.draw(ch);
+                out.draw(ch);
                 sf::VertexArray cross(sf::Lines, 4);
                 cross[0] = sf::Vertex(sf::Vector2f(mw.x - 8.f, mw.y), sf::Color::Magenta);
                 cross[1] = sf::Vertex(sf::Vector2f(mw.x + 8.f, mw.y), sf::Color::Magenta);
                 cross[2] = sf::Vertex(sf::Vector2f(mw.x, mw.y - 8.f), sf::Color::Magenta);
                 cross[3] = sf::Vertex(sf::Vector2f(mw.x, mw.y + 8.f), sf::Color::Magenta);
-                window.draw(cross);
+                out.draw(cross);
 
                 // Show raw pixel coords and mapped world coords on screen
                 sf::Text dbgText;
@@ -1154,7 +1166,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 std::ostringstream ss; ss << "pixel: (" << mp.x << "," << mp.y << ")  world: (" << static_cast<int>(mw.x) << "," << static_cast<int>(mw.y) << ")";
                 dbgText.setString(ss.str());
                 dbgText.setPosition(mw.x + 12.f, mw.y - 18.f);
-                window.draw(dbgText);
+                out.draw(dbgText);
             }
 
             // Draw back button (icon + text) at top-right of the panel - explicit colors and hover state
@@ -1185,7 +1197,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                         sf::RectangleShape centerRect(sf::Vector2f(centerR - centerL, lineThickness));
                         centerRect.setPosition(centerL, lineY);
                         centerRect.setFillColor(colOpaque);
-                        window.draw(centerRect);
+                        out.draw(centerRect);
                     }
                     if (centerL > lx_full + 1.f) {
                         sf::VertexArray leftGrad(sf::Triangles, 6);
@@ -1195,7 +1207,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                         leftGrad[3] = sf::Vertex(sf::Vector2f(lx_full, lineY), colTransparentLocal);
                         leftGrad[4] = sf::Vertex(sf::Vector2f(centerL, lineY + lineThickness), colOpaque);
                         leftGrad[5] = sf::Vertex(sf::Vector2f(lx_full, lineY + lineThickness), colTransparentLocal);
-                        window.draw(leftGrad);
+                        out.draw(leftGrad);
                     }
                     if (centerR < rx_full - 1.f) {
                         sf::VertexArray rightGrad(sf::Triangles, 6);
@@ -1205,7 +1217,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                         rightGrad[3] = sf::Vertex(sf::Vector2f(centerR, lineY), colOpaque);
                         rightGrad[4] = sf::Vertex(sf::Vector2f(rx_full, lineY + lineThickness), colTransparentLocal);
                         rightGrad[5] = sf::Vertex(sf::Vector2f(centerR, lineY + lineThickness), colOpaque);
-                        window.draw(rightGrad);
+                        out.draw(rightGrad);
                     }
                 }
 
@@ -1219,7 +1231,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 backButtonBorder.setOutlineThickness(2.f);
                 backButtonBorder.setOrigin(0.f, 0.f);
                 backButtonBorder.setPosition(backPos);
-                window.draw(backButtonBorder);
+                out.draw(backButtonBorder);
 
                 // Icon slot
                 float slotW = ICON_W;
@@ -1237,9 +1249,9 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                     float spriteX = backPos.x + 8.f + (slotW - spriteW) * 0.5f;
                     float spriteY = backPos.y + 6.f + (slotH - bts.y * scale) * 0.5f;
                     backIconSprite.setPosition(spriteX, spriteY);
-                    window.draw(backIconSprite);
+                    out.draw(backIconSprite);
                 } else {
-                    window.draw(iconSlot);
+                    out.draw(iconSlot);
                 }
 
                 // Back label
@@ -1252,13 +1264,13 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
                 float tx = backPos.x + 8.f + slotW + ICON_PAD;
                 float ty = backPos.y + (backHeight - tb.height) / 2.f - tb.top;
                 backButtonText.setPosition(tx, ty);
-                window.draw(backButtonText);
+                out.draw(backButtonText);
             }
         }
 
         fadeRect.setPosition(0.f,0.f);
         fadeRect.setSize(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
-        window.draw(fadeRect);
+        out.draw(fadeRect);
     } else {
         // Cutscene playback: draw world using cameraView so background moves with the camera
         window.setView(cameraView);
@@ -1276,10 +1288,10 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
             backgroundSprite.setScale(1.f, 1.f);
         }
         backgroundSprite.setPosition(0.f, 0.f);
-        window.draw(backgroundSprite);
+        out.draw(backgroundSprite);
         // draw world objects that move with the camera
-        window.draw(planetSprite);
-        window.draw(shipSprite);
+        out.draw(planetSprite);
+        out.draw(shipSprite);
 
         // Draw fade overlay in default view space (screen-aligned). First switch back to default view
         window.setView(window.getDefaultView());
@@ -1287,7 +1299,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
         // Draw dialogue UI if active
         if (dialogueActive) {
             // Draw dialogue box
-            window.draw(dialogueBox);
+            out.draw(dialogueBox);
 
             // Compose visible substring for typewriter effect
             std::string visible;
@@ -1311,19 +1323,19 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
             float textX = boxPos.x - dialogueBox.getSize().x / 2.0f + padding;
             float textY = boxPos.y - dialogueBox.getSize().y / 2.0f + padding;
             dialogueText.setPosition(textX, textY);
-            window.draw(dialogueText);
+            out.draw(dialogueText);
 
             // Position skip prompt at bottom-right inside the dialog box
             sf::FloatRect spb = skipPromptText.getLocalBounds();
             float spX = boxPos.x + dialogueBox.getSize().x / 2.0f - padding - (spb.width + spb.left);
             float spY = boxPos.y + dialogueBox.getSize().y / 2.0f - padding - (spb.height + spb.top);
             skipPromptText.setPosition(spX, spY);
-            window.draw(skipPromptText);
+            out.draw(skipPromptText);
         }
 
         fadeRect.setPosition(0.f,0.f);
         fadeRect.setSize(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
-        window.draw(fadeRect);
+        out.draw(fadeRect);
     }
 
     window.display();
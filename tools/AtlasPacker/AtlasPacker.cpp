@@ -0,0 +1,215 @@
+// Build-time texture atlas packer.
+//
+//   AtlasPacker <manifest> <outputDir>
+//
+// Reads a manifest of sprite sheets / images, slices sheets into frames and packs every frame into as
+// few pages as possible. Writes <outputDir>/atlas_<n>.png and <outputDir>/atlas.txt, which the game
+// loads through TextureAtlas (include/TextureAtlas.h).
+//
+// Manifest lines (paths are relative to the working directory, '#' starts a comment):
+//   sheet  <name> <path> <frameW> <frameH>   grid sheet, frames named <name>_0, <name>_1, ... row by row
+//   image  <name> <path>                     single frame named <name>
+//   frames <name> <pathPrefix> <count>       per-frame files <pathPrefix>0.png .. <pathPrefix><count-1>.png
+//
+// All frames of one manifest entry are kept on the same page so an animation only ever binds one texture.
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const unsigned kPageSize = 4096; // safe on every GPU SFML 2.6 targets
+const unsigned kPadding = 2;     // transparent gutter so neighbouring frames never bleed
+
+struct Frame {
+    Frame(const std::string& name, const sf::Image* source, const sf::IntRect& srcRect)
+        : name(name), source(source), srcRect(srcRect) {}
+
+    std::string name;
+    const sf::Image* source;
+    sf::IntRect srcRect;
+    int page = -1;
+    sf::Vector2u pos;
+};
+
+struct Group {
+    std::vector<Frame> frames;
+};
+
+// Shelf packer: frames fill rows left to right; a new shelf starts under the tallest frame of the row
+struct Page {
+    unsigned cursorX = 0;
+    unsigned cursorY = 0;
+    unsigned shelfHeight = 0;
+
+    bool place(unsigned w, unsigned h, sf::Vector2u& out) {
+        w += kPadding; h += kPadding;
+        if (w > kPageSize || h > kPageSize) return false;
+        if (cursorX + w > kPageSize) {
+            cursorX = 0;
+            cursorY += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (cursorY + h > kPageSize) return false;
+        out = sf::Vector2u(cursorX, cursorY);
+        cursorX += w;
+        shelfHeight = std::max(shelfHeight, h);
+        return true;
+    }
+};
+
+// Place every frame of the group on one page (all or nothing)
+bool placeGroup(Page& page, Group& group, int pageIndex) {
+    Page trial = page;
+    std::vector<sf::Vector2u> positions(group.frames.size());
+    for (size_t i = 0; i < group.frames.size(); ++i) {
+        const sf::IntRect& r = group.frames[i].srcRect;
+        if (!trial.place(static_cast<unsigned>(r.width), static_cast<unsigned>(r.height), positions[i])) return false;
+    }
+    page = trial;
+    for (size_t i = 0; i < group.frames.size(); ++i) {
+        group.frames[i].page = pageIndex;
+        group.frames[i].pos = positions[i];
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "usage: AtlasPacker <manifest> <outputDir>" << std::endl;
+        return 1;
+    }
+    const std::string manifestPath = argv[1];
+    const std::string outDir = argv[2];
+
+    std::ifstream manifest(manifestPath);
+    if (!manifest) {
+        std::cerr << "Error opening atlas manifest: " << manifestPath << std::endl;
+        return 1;
+    }
+
+    // Images must stay at stable addresses while frames point at them
+    std::vector<std::unique_ptr<sf::Image>> images;
+    std::vector<Group> groups;
+    auto loadImage = [&](const std::string& path) -> const sf::Image* {
+        auto img = std::make_unique<sf::Image>();
+        if (!img->loadFromFile(path)) {
+            std::cerr << "Error loading atlas source: " << path << std::endl;
+            return nullptr;
+        }
+        images.push_back(std::move(img));
+        return images.back().get();
+    };
+
+    std::string line;
+    int lineNo = 0;
+    bool ok = true;
+    while (std::getline(manifest, line)) {
+        ++lineNo;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+        std::istringstream in(line);
+        std::string kind, name;
+        if (!(in >> kind)) continue;
+        in >> name;
+
+        Group group;
+        if (kind == "sheet") {
+            std::string path; int fw = 0, fh = 0;
+            in >> path >> fw >> fh;
+            const sf::Image* img = (fw > 0 && fh > 0) ? loadImage(path) : nullptr;
+            if (!img) { ok = false; continue; }
+            // Same slicing the game used on the loose sheets: full grid, row by row
+            int cols = static_cast<int>(img->getSize().x) / fw;
+            int rows = static_cast<int>(img->getSize().y) / fh;
+            for (int r = 0; r < rows; ++r)
+                for (int c = 0; c < cols; ++c)
+                    group.frames.emplace_back(name + "_" + std::to_string(r * cols + c), img, sf::IntRect(c * fw, r * fh, fw, fh));
+        } else if (kind == "image") {
+            std::string path;
+            in >> path;
+            const sf::Image* img = loadImage(path);
+            if (!img) { ok = false; continue; }
+            group.frames.emplace_back(name, img, sf::IntRect(0, 0, static_cast<int>(img->getSize().x), static_cast<int>(img->getSize().y)));
+        } else if (kind == "frames") {
+            std::string prefix; int count = 0;
+            in >> prefix >> count;
+            for (int i = 0; i < count; ++i) {
+                const sf::Image* img = loadImage(prefix + std::to_string(i) + ".png");
+                if (!img) { ok = false; continue; }
+                group.frames.emplace_back(name + "_" + std::to_string(i), img, sf::IntRect(0, 0, static_cast<int>(img->getSize().x), static_cast<int>(img->getSize().y)));
+            }
+        } else {
+            std::cerr << manifestPath << ":" << lineNo << ": unknown entry '" << kind << "'" << std::endl;
+            ok = false;
+            continue;
+        }
+        if (!group.frames.empty()) groups.push_back(std::move(group));
+    }
+    if (!ok) return 1;
+
+    // Tallest groups first keeps shelves dense
+    std::vector<Group*> order;
+    for (Group& g : groups) order.push_back(&g);
+    auto groupHeight = [](const Group* g) {
+        int h = 0;
+        for (const Frame& f : g->frames) h = std::max(h, f.srcRect.height);
+        return h;
+    };
+    std::stable_sort(order.begin(), order.end(), [&](const Group* a, const Group* b) { return groupHeight(a) > groupHeight(b); });
+
+    std::vector<Page> pages;
+    for (Group* g : order) {
+        bool placed = false;
+        for (size_t p = 0; p < pages.size() && !placed; ++p) placed = placeGroup(pages[p], *g, static_cast<int>(p));
+        if (!placed) {
+            pages.emplace_back();
+            if (!placeGroup(pages.back(), *g, static_cast<int>(pages.size() - 1))) {
+                std::cerr << "Atlas entry '" << g->frames.front().name << "' does not fit on a " << kPageSize << "px page" << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    // Compose and save the pages (cropped to the used height)
+    std::ofstream meta(outDir + "/atlas.txt");
+    if (!meta) {
+        std::cerr << "Error writing atlas metadata in " << outDir << std::endl;
+        return 1;
+    }
+    meta << "# generated by AtlasPacker from " << manifestPath << "\n";
+    for (size_t p = 0; p < pages.size(); ++p) {
+        unsigned usedHeight = pages[p].cursorY + pages[p].shelfHeight;
+        sf::Image page;
+        page.create(kPageSize, usedHeight, sf::Color::Transparent);
+        for (const Group& g : groups)
+            for (const Frame& f : g.frames)
+                if (f.page == static_cast<int>(p)) page.copy(*f.source, f.pos.x, f.pos.y, f.srcRect);
+
+        std::string file = outDir + "/atlas_" + std::to_string(p) + ".png";
+        if (!page.saveToFile(file)) {
+            std::cerr << "Error writing atlas page: " << file << std::endl;
+            return 1;
+        }
+        meta << "page " << p << " " << file << "\n";
+    }
+
+    size_t frameCount = 0;
+    for (const Group& g : groups) {
+        for (const Frame& f : g.frames) {
+            meta << "frame " << f.name << " " << f.page << " " << f.pos.x << " " << f.pos.y << " "
+                 << f.srcRect.width << " " << f.srcRect.height << "\n";
+            ++frameCount;
+        }
+    }
+
+    std::cout << "Packed " << frameCount << " frames into " << pages.size() << " page(s)" << std::endl;
+    return 0;
+}